@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_ALPHABET_H
+#define RADIXTREEPROJECT_ALPHABET_H
+using namespace std;
+
+// Alphabet policies for "AlphabetRadixTree"
+//
+// Every policy tells the tree, at compile time:
+//
+// -- BITS:    the width of one packed symbol (symbols never straddle two 64-bit words, so "64 / BITS" fit in a word)
+// -- FANOUT:  the number of distinct symbols, i.e. the most children a node can have
+// -- DENSE:   whether children are dispatched through an array of "FANOUT" pointers indexed by symbol code (best for...
+//             ...small alphabets) or through a short sorted list of the children actually present (best for large ones)
+// -- encode:  the code of a character, or -1 if it is not part of the alphabet (the null terminator never is)
+// -- decode:  the character of a code
+//
+// Codes are given in the same order as the characters themselves, so packed labels compare like the strings would.
+//
+
+// The four DNA bases, 2 bits each: A = 00, C = 01, G = 10, T = 11
+struct DNA4 {
+
+    static const int BITS = 2;
+    static const int FANOUT = 4;
+    static const bool DENSE = true;
+
+    static int encode(unsigned char c) {
+        switch (c) {
+            case 'A': return 0;
+            case 'C': return 1;
+            case 'G': return 2;
+            case 'T': return 3;
+            default: return -1;
+        }
+    }
+
+    static char decode(int code) { return "ACGT"[code]; }
+
+};
+
+// The IUPAC nucleotide codes (ambiguity letters included) plus the '-' gap, 16 symbols in 4 bits each
+struct IUPAC {
+
+    static const int BITS = 4;
+    static const int FANOUT = 16;
+    static const bool DENSE = true;
+
+    static int encode(unsigned char c) {
+        switch (c) {
+            case '-': return 0;
+            case 'A': return 1;
+            case 'B': return 2;
+            case 'C': return 3;
+            case 'D': return 4;
+            case 'G': return 5;
+            case 'H': return 6;
+            case 'K': return 7;
+            case 'M': return 8;
+            case 'N': return 9;
+            case 'R': return 10;
+            case 'S': return 11;
+            case 'T': return 12;
+            case 'V': return 13;
+            case 'W': return 14;
+            case 'Y': return 15;
+            default: return -1;
+        }
+    }
+
+    static char decode(int code) { return "-ABCDGHKMNRSTVWY"[code]; }
+
+};
+
+// The twenty standard amino acids, 5 bits each (12 per word, the top 4 bits of every word stay unused)
+struct Protein20 {
+
+    static const int BITS = 5;
+    static const int FANOUT = 20;
+    static const bool DENSE = true;
+
+    static int encode(unsigned char c) {
+        switch (c) {
+            case 'A': return 0;
+            case 'C': return 1;
+            case 'D': return 2;
+            case 'E': return 3;
+            case 'F': return 4;
+            case 'G': return 5;
+            case 'H': return 6;
+            case 'I': return 7;
+            case 'K': return 8;
+            case 'L': return 9;
+            case 'M': return 10;
+            case 'N': return 11;
+            case 'P': return 12;
+            case 'Q': return 13;
+            case 'R': return 14;
+            case 'S': return 15;
+            case 'T': return 16;
+            case 'V': return 17;
+            case 'W': return 18;
+            case 'Y': return 19;
+            default: return -1;
+        }
+    }
+
+    static char decode(int code) { return "ACDEFGHIKLMNPQRSTVWY"[code]; }
+
+};
+
+// Raw bytes (anything but the null terminator), 8 bits each, children kept in a sparse sorted list
+struct Bytes {
+
+    static const int BITS = 8;
+    static const int FANOUT = 256;
+    static const bool DENSE = false;
+
+    static int encode(unsigned char c) { return c ? c : -1; }
+    static char decode(int code) { return (char) code; }
+
+};
+
+#endif //RADIXTREEPROJECT_ALPHABET_H
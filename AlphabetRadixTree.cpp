@@ -0,0 +1,386 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+using namespace std;
+
+#include "AlphabetRadixTree.h"
+
+// Index of the lowest set bit of a non-zero word, i.e. the position of the first differing bit after a XOR
+static inline int trailingZeros(uint64_t v) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward64(&i, v);
+    return (int) i;
+#else
+    return __builtin_ctzll(v);
+#endif
+}
+
+template <typename Alphabet>
+AlphabetRadixTree<Alphabet>::Node::Node(const uint64_t* src, int srcWords, int offset, int n, bool e) : len(n), end(e) {
+
+    // Every destination word is aligned, so we can simply extract a word of symbols at a time from the source
+    bits = new uint64_t[wordsFor(len)];
+    for (int i = 0; i < len; i += PER_WORD) bits[i / PER_WORD] = keepSymbols(extract(src, srcWords, offset + i), len - i);
+
+}
+
+// The code of every byte under "Alphabet" (-1 for bytes outside it, up to 255 for "Bytes", hence a "short"), looked...
+// ...up instead of calling "encode" since the "switch" of "encode" is a branch per character that random bases keep...
+// ...mispredicting
+template <typename Alphabet>
+struct CodeTable {
+    short code[256];
+    CodeTable() { for (int c = 0; c < 256; c++) code[c] = (short) Alphabet::encode((unsigned char) c); }
+};
+
+template <typename Alphabet>
+bool AlphabetRadixTree<Alphabet>::pack(const char* str, int n, uint64_t* out) {
+
+    static const CodeTable<Alphabet> table;
+
+    // The alphabet's codes keep the same order as the characters themselves (e.g. A = 00, C = 01, G = 10, T = 11)
+    // Each word is put together in a register and stored once, and the characters outside the alphabet are looked...
+    // ...for once per word, OR-ing the codes (-1 sets every bit) rather than checking each one
+
+    for (int i = 0; i < n; i += PER_WORD) {
+
+        int m = n - i < PER_WORD ? n - i : PER_WORD, bad = 0;
+        uint64_t v = 0;
+
+        for (int j = 0; j < m; j++) {
+            int c = table.code[(unsigned char) str[i + j]];
+            bad |= c;
+            v |= (uint64_t) (c & (int) SYMBOL_MASK) << (BITS * j);
+        }
+
+        if (bad < 0) return false;
+        out[i / PER_WORD] = v;
+
+    }
+
+    return true;
+
+}
+
+template <typename Alphabet>
+uint64_t AlphabetRadixTree<Alphabet>::extract(const uint64_t* w, int words, int pos) {
+
+    // Symbol "pos" sits "shift" bits into word "j", so the symbols we want are the top part of word "j"...
+    // ...followed by the bottom part of word "j + 1" (when "pos" is not aligned and that word exists)
+
+    int j = pos / PER_WORD, offset = pos % PER_WORD;
+    if (j >= words) return 0;
+
+    uint64_t v = w[j] >> (BITS * offset);
+    if (offset && j + 1 < words) v |= w[j + 1] << (BITS * (PER_WORD - offset));
+
+    return v & WORD_MASK;
+
+}
+
+template <typename Alphabet>
+int AlphabetRadixTree<Alphabet>::prefix(const uint64_t* x, int xWords, int offset, int n, const uint64_t* key, int m) {
+
+    // Same idea as "RadixTree::prefix", except that each iteration compares a whole word of symbols at once:
+    // XOR-ing the two words leaves set bits only where symbols differ, and the lowest set bit tells us which one it was
+    // Symbols past the end of either label are compared too, but the result is clamped to the shorter length anyway
+
+    int limit = n < m ? n : m;
+
+    for (int i = 0; i < limit; i += PER_WORD) {
+
+        uint64_t diff = extract(x, xWords, offset + i) ^ key[i / PER_WORD];
+
+        if (diff) {
+            int k = i + trailingZeros(diff) / BITS;
+            return k < limit ? k : limit;
+        }
+
+    }
+
+    return limit;
+
+}
+
+template <typename Alphabet>
+typename AlphabetRadixTree<Alphabet>::Node* AlphabetRadixTree<Alphabet>::find(const uint64_t* x, int xWords, int n) {
+
+    Node* t = root;
+    int offset = 0;
+
+    while (offset < n) {
+
+        // The next symbol of "x" tells us directly which child could continue the match, no sibling walk needed
+        t = t->child.get(symbolAt(x, offset));
+        if (!t) return 0;
+
+        // Only part of the child matches, so "x" cannot be in the tree
+        int k = prefix(x, xWords, offset, n - offset, t->bits, t->len);
+        if (k < t->len) return 0;
+
+        offset += k;
+
+    }
+
+    // All of "x" has been consumed, it is found only if a string ends exactly here
+    return t->end ? t : 0;
+
+}
+
+template <typename Alphabet>
+void AlphabetRadixTree<Alphabet>::split(Node* t, int k) {
+
+    // Split the following node at position 4:  [parent ---- "ACGTCA (end)" ---- children]
+    // Required Result:                         [parent ---- "ACGT" ---- "CA (end)" ---- children]
+
+    // The new node takes everything after the first "k" symbols along with all of the current node's children
+
+    Node* p = new Node(t->bits, wordsFor(t->len), k, t->len - k, t->end);
+    p->child.swap(t->child);
+    t->child.set(symbolAt(p->bits, 0), p);
+    nodeCount++;
+
+    // The first "k" symbols are already word-aligned in "t", so we only need to copy the words and mask the last one
+
+    uint64_t* a = new uint64_t[wordsFor(k)];
+    for (int w = 0; w < wordsFor(k); w++) a[w] = keepSymbols(t->bits[w], k - PER_WORD * w);
+
+    delete[] t->bits;
+    t->bits = a;
+    t->len = k;
+    t->end = false;
+
+}
+
+template <typename Alphabet>
+bool AlphabetRadixTree<Alphabet>::insert(const uint64_t* x, int xWords, int n) {
+
+    Node* t = root;
+    int offset = 0;
+
+    while (offset < n) {
+
+        // The child that matches the next symbol of the key, a new node goes right there if there is none
+
+        int c = symbolAt(x, offset);
+        Node* next = t->child.get(c);
+
+        if (!next) {
+            t->child.set(c, new Node(x, xWords, offset, n - offset, true));
+            nodeCount++;
+            stringCount++;
+            return true;
+        }
+
+        t = next;
+
+        // Part of the child is a prefix of the key, split it so that the common part becomes a node on its own
+        int k = prefix(x, xWords, offset, n - offset, t->bits, t->len);
+        if (k < t->len) split(t, k);
+
+        offset += k;
+
+    }
+
+    // The key ends exactly at this node, so flag it (unless it was already there)
+    if (t->end) return false;
+
+    t->end = true;
+    stringCount++;
+
+    return true;
+
+}
+
+template <typename Alphabet>
+void AlphabetRadixTree<Alphabet>::join(Node* t) {
+
+    // Join the following node (with its child): [parent ---- "ACGT" ---- "CA (end)" ---- children]
+    // Required Result:                          [parent ---- "ACGTCA (end)" ---- children]
+
+    Node* p = 0;
+    for (int i = 0; i < t->child.slots(); i++) if (t->child.at(i)) p = t->child.at(i);
+
+    int len = t->len + p->len;
+
+    uint64_t* a = new uint64_t[wordsFor(len)];
+    for (int w = 0; w < wordsFor(len); w++) a[w] = w < wordsFor(t->len) ? t->bits[w] : 0;
+
+    // The child's symbols go right after the node's own, which is generally not a word boundary, so each word of...
+    // ...symbols is shifted into place and may spill over into the following word
+
+    for (int i = 0; i < p->len; i += PER_WORD) {
+
+        uint64_t v = keepSymbols(p->bits[i / PER_WORD], p->len - i);
+        int pos = t->len + i, j = pos / PER_WORD, offset = pos % PER_WORD;
+
+        a[j] |= (v << (BITS * offset)) & WORD_MASK;
+        if (offset && j + 1 < wordsFor(len)) a[j + 1] |= v >> (BITS * (PER_WORD - offset));
+
+    }
+
+    delete[] t->bits;
+    t->bits = a;
+    t->len = len;
+    t->end = p->end;
+
+    // Adopt the child's children, leaving the child without any so that deleting it does not delete them too
+    t->child.clear();
+    t->child.swap(p->child);
+
+    delete p;
+    nodeCount--;
+
+}
+
+template <typename Alphabet>
+bool AlphabetRadixTree<Alphabet>::remove(const uint64_t* x, int xWords, int n) {
+
+    // "parent" is the node we came from, "c" is the symbol under which "parent" holds the current node
+
+    Node* parent = 0, * t = root;
+    int offset = 0, c = 0;
+
+    while (offset < n) {
+
+        parent = t;
+        c = symbolAt(x, offset);
+        t = t->child.get(c);
+        if (!t) return false;
+
+        int k = prefix(x, xWords, offset, n - offset, t->bits, t->len);
+        if (k < t->len) return false;
+
+        offset += k;
+
+    }
+
+    // The key ends at this node, it is only in the tree if a string ends here
+    if (!t->end) return false;
+    t->end = false;
+    stringCount--;
+
+    int children = t->child.size();
+
+    if (!children) {
+
+        // A leaf: unlink it from its parent, after which the parent may be left with a single child
+        parent->child.set(c, 0);
+        delete t;
+        nodeCount--;
+
+        if (parent != root && !parent->end && parent->child.size() == 1) join(parent);
+
+    } else if (children == 1) {
+
+        // No longer the end of a string and left with a single child, so it gets merged with that child
+        join(t);
+
+    }
+
+    return true;
+
+}
+
+template <typename Alphabet>
+long long AlphabetRadixTree<Alphabet>::walk(Node* t, bool destroy) {
+
+    // The stack holds the nodes still to be visited, a node's children being pushed when it is popped
+
+    int capacity = 64, top = 0;
+    Node** stack = (Node**) malloc(capacity * sizeof(Node*));
+    long long bytes = 0;
+
+    if (t) stack[top++] = t;
+
+    while (top) {
+
+        t = stack[--top];
+
+        if (top + t->child.slots() > capacity) {
+            capacity = 2 * (top + t->child.slots());
+            stack = (Node**) realloc(stack, capacity * sizeof(Node*));
+        }
+
+        for (int i = 0; i < t->child.slots(); i++) if (t->child.at(i)) stack[top++] = t->child.at(i);
+
+        if (destroy) delete t;
+        else bytes += wordsFor(t->len) * sizeof(uint64_t);
+
+    }
+
+    free(stack);
+
+    return bytes;
+
+}
+
+// Addition function, packs the string and inserts it, rejecting anything outside the alphabet
+// Keys of up to "KEY_WORDS" words are packed on the stack, longer ones on the heap (as are the other public functions)
+template <typename Alphabet>
+bool AlphabetRadixTree<Alphabet>::addString(const char* str) {
+
+    int n = 0;
+    while (str[n]) n++;
+    if (!n) return false;
+
+    uint64_t local[KEY_WORDS];
+    uint64_t* x = wordsFor(n) <= KEY_WORDS ? local : new uint64_t[wordsFor(n)];
+    bool added = pack(str, n, x) && insert(x, wordsFor(n), n);
+    if (x != local) delete[] x;
+
+    return added;
+
+}
+
+// Deletion function, packs the string and removes it from the tree if it exists
+template <typename Alphabet>
+void AlphabetRadixTree<Alphabet>::deleteString(const char* str) {
+
+    int n = 0;
+    while (str[n]) n++;
+    if (!n) return;
+
+    uint64_t local[KEY_WORDS];
+    uint64_t* x = wordsFor(n) <= KEY_WORDS ? local : new uint64_t[wordsFor(n)];
+    if (pack(str, n, x)) remove(x, wordsFor(n), n);
+    if (x != local) delete[] x;
+
+}
+
+// Searching function, returns boolean value based on the result of the finder function
+template <typename Alphabet>
+bool AlphabetRadixTree<Alphabet>::searchString(const char* str) {
+
+    int n = 0;
+    while (str[n]) n++;
+    if (!n) return false;
+
+    uint64_t local[KEY_WORDS];
+    uint64_t* x = wordsFor(n) <= KEY_WORDS ? local : new uint64_t[wordsFor(n)];
+    bool found = pack(str, n, x) && find(x, wordsFor(n), n) != 0;
+    if (x != local) delete[] x;
+
+    return found;
+
+}
+
+// Label memory function, returns the number of bytes taken by the packed labels of all nodes
+template <typename Alphabet>
+long long AlphabetRadixTree<Alphabet>::labelBytes() {
+    return walk(root, false);
+}
+
+// The alphabets this library is built for, any other alphabet policy needs its own line here
+template class AlphabetRadixTree<DNA4>;
+template class AlphabetRadixTree<IUPAC>;
+template class AlphabetRadixTree<Protein20>;
+template class AlphabetRadixTree<Bytes>;
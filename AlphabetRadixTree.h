@@ -0,0 +1,283 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_ALPHABETRADIXTREE_H
+#define RADIXTREEPROJECT_ALPHABETRADIXTREE_H
+#include <cstdint>
+#include <cstdlib>
+using namespace std;
+
+#include "Alphabet.h"
+
+// Child dispatch of "AlphabetRadixTree" nodes, picked at compile time from the alphabet's "DENSE" flag
+//
+// Both versions offer the same interface: "get" / "set" a child by symbol code ("set" to NULL removes it), "size"...
+// ...the number of children, "at" to go through them (in code order) for "i" from 0 to "slots() - 1" (where "at"...
+// ...may return NULL for a dense table), "swap" to exchange all children with another table, and "bytes" the memory...
+// ...taken outside the node itself.
+//
+template <typename Node, int FANOUT, bool DENSE>
+class ChildTable;
+
+// Dense version: one pointer per symbol, going down a level is a single array load
+template <typename Node, int FANOUT>
+class ChildTable<Node, FANOUT, true> {
+private:
+    Node* child[FANOUT];
+public:
+    ChildTable() { for (int c = 0; c < FANOUT; c++) child[c] = 0; }
+    Node* get(int c) const { return child[c]; }
+    void set(int c, Node* t) { child[c] = t; }
+    int size() const { int n = 0; for (int c = 0; c < FANOUT; c++) n += child[c] != 0; return n; }
+    int slots() const { return FANOUT; }
+    Node* at(int i) const { return child[i]; }
+    void clear() { for (int c = 0; c < FANOUT; c++) child[c] = 0; }
+    void swap(ChildTable& other) { for (int c = 0; c < FANOUT; c++) { Node* t = child[c]; child[c] = other.child[c]; other.child[c] = t; } }
+    long long bytes() const { return 0; }
+};
+
+// Sparse version: the codes of the children actually present, sorted, alongside their pointers
+template <typename Node, int FANOUT>
+class ChildTable<Node, FANOUT, false> {
+private:
+    unsigned char* codes;
+    Node** child;
+    short n;
+    short capacity;
+
+    int position(int c) const { int i = 0; while (i < n && codes[i] < c) i++; return i; }
+
+public:
+    ChildTable() : codes(0), child(0), n(0), capacity(0) {}
+    ~ChildTable() { free(codes); free(child); }
+
+    Node* get(int c) const { int i = position(c); return i < n && codes[i] == c ? child[i] : 0; }
+
+    void set(int c, Node* t) {
+
+        int i = position(c);
+
+        if (i < n && codes[i] == c) {
+
+            if (t) { child[i] = t; return; }
+
+            // Removal: close the gap
+            for (int j = i; j + 1 < n; j++) { codes[j] = codes[j + 1]; child[j] = child[j + 1]; }
+            n--;
+            return;
+
+        }
+
+        if (!t) return;
+
+        if (n == capacity) {
+            capacity = capacity ? 2 * capacity : 2;
+            codes = (unsigned char*) realloc(codes, capacity);
+            child = (Node**) realloc(child, capacity * sizeof(Node*));
+        }
+
+        for (int j = n; j > i; j--) { codes[j] = codes[j - 1]; child[j] = child[j - 1]; }
+        codes[i] = (unsigned char) c;
+        child[i] = t;
+        n++;
+
+    }
+
+    int size() const { return n; }
+    int slots() const { return n; }
+    Node* at(int i) const { return child[i]; }
+    void clear() { n = 0; }
+
+    void swap(ChildTable& other) {
+        unsigned char* c = codes; codes = other.codes; other.codes = c;
+        Node** t = child; child = other.child; other.child = t;
+        short k = n; n = other.n; other.n = k;
+        k = capacity; capacity = other.capacity; other.capacity = k;
+    }
+
+    long long bytes() const { return capacity * (long long) (1 + sizeof(Node*)); }
+};
+
+// A Radix Tree over any alphabet, storing labels packed at "Alphabet::BITS" bits per symbol
+//
+// It follows the same prefix / split / join logic as "RadixTree", with three differences:
+//
+// 1. Edge labels are stored packed, "64 / BITS" symbols per 64-bit word, instead of one byte per character
+// 2. The null terminator is not stored as part of the label; instead every node carries an "end" flag which is set...
+//    ...when a stored string ends exactly after this node's label
+// 3. Instead of a "link" / "next" sibling list, children are dispatched by the first symbol of their label, through...
+//    ...a "ChildTable" chosen by the alphabet (a direct array for small alphabets, a sorted list for large ones)
+//
+// Thanks to the packing, "prefix" compares a whole word of symbols per iteration using a XOR followed by a...
+// ...count-trailing-zeros, and "split" / "join" move whole words rather than single characters.
+//
+// One implementation serves every alphabet: the policy only fixes, at compile time, the symbol width, the fanout,...
+// ...the child dispatch and the encoding (see "Alphabet.h"). The member functions live in "AlphabetRadixTree.cpp",...
+// ...which instantiates the tree for the alphabets found in "Alphabet.h"; a new alphabet needs a line added there.
+//
+// It only has the core operations and O(1) counters: none of "RadixTree"'s arena, iterator, printing, snapshots or...
+// ...concurrent-read mode. "RadixTreeTests" checks it against "RadixTree" for every alphabet.
+//
+template <typename Alphabet>
+class AlphabetRadixTree {
+private:
+
+    // Symbols per word, and the bits of a word actually used by them
+    static const int BITS = Alphabet::BITS;
+    static const int PER_WORD = 64 / BITS;
+    static const uint64_t WORD_MASK = PER_WORD * BITS == 64 ? ~0ULL : (1ULL << (PER_WORD * BITS)) - 1;
+    static const uint64_t SYMBOL_MASK = (1ULL << BITS) - 1;
+
+    // Words of a packed key kept on the stack by the public functions (256 DNA bases), longer keys go on the heap
+    static const int KEY_WORDS = 8;
+
+    // Alphabet Radix Tree's private inner class: Node
+    class Node {
+    public:
+
+        // ---- The "child" nodes, child "c" being the one whose label starts with symbol code "c"
+        ChildTable<Node, Alphabet::FANOUT, Alphabet::DENSE> child;
+
+        // The packed label of the node, symbol "i" lives in word "i / PER_WORD" at bit position "BITS * (i % PER_WORD)"
+        uint64_t* bits;
+
+        // Number of symbols in the node's label (the terminator is never counted, it is represented by "end" instead)
+        int len;
+
+        // Whether a stored string ends after this node's label (i.e. what a null terminator would mean in "RadixTree")
+        bool end;
+
+        // Basic constructor, copies "n" symbols starting at symbol "offset" of the packed array "src" of "srcWords" words
+        Node(const uint64_t* src, int srcWords, int offset, int n, bool e);
+
+        // Basic deconstructor, de-allocates the packed label only (children are taken care of by the tree)
+        ~Node() { delete[] bits; }
+
+    };
+
+    // Alphabet Radix Tree's root node, an empty-label node whose children are the first level of the tree
+    Node* root;
+
+    // Live number of strings and nodes in the tree (the root not included), kept up to date by every insertion and...
+    // ...removal, as in "RadixTree"
+    int stringCount;
+    int nodeCount;
+
+    // Number of 64-bit words needed to hold "n" packed symbols
+    static int wordsFor(int n) { return (n + PER_WORD - 1) / PER_WORD; }
+
+    // Keeps only the lowest "n" symbols of a word, clearing whatever lies past the end of a label
+    static uint64_t keepSymbols(uint64_t v, int n) { return n < PER_WORD ? v & ((1ULL << (BITS * n)) - 1) : v & WORD_MASK; }
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Packing function, responsible for encoding the "n" characters of "str" into codes stored in "out"
+    // "out" must have room for at least "wordsFor(n)" words
+    //
+    static bool pack(const char* str, int n, uint64_t* out);
+    // Returns false if "str" contains any character outside the alphabet
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Extraction function, responsible for reading the "PER_WORD" symbols starting at symbol "pos" of packed array...
+    // ..."w" (of "words" words) as a single 64-bit word, regardless of whether "pos" is aligned to a word or not
+    //
+    static uint64_t extract(const uint64_t* w, int words, int pos);
+    // Returns the symbols packed into one word (symbols past the end of the array read as zero)
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Symbol reading function, responsible for reading the single symbol at position "pos" of packed array "w"
+    //
+    static int symbolAt(const uint64_t* w, int pos) { return (int) ((w[pos / PER_WORD] >> (BITS * (pos % PER_WORD))) & SYMBOL_MASK); }
+    // Returns the code of the symbol, used to pick the child to descend into
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Prefix function, responsible for comparing the "n" symbols of "x" starting at symbol "offset" with the "m"...
+    // ...symbols of "key", a word of symbols at a time
+    //
+    static int prefix(const uint64_t* x, int xWords, int offset, int n, const uint64_t* key, int m);
+    // Returns the number of common prefix symbols
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Finder (Search) function, responsible for finding the "n" symbols of packed key "x" in the tree
+    //
+    Node* find(const uint64_t* x, int xWords, int n);
+    // Returns pointer to the node at which "x" ends with its "end" flag set, if found
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Splitting function, responsible for splitting a node into two at symbol position "k"
+    //
+    void split(Node* t, int k);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Insertion function, responsible for inserting the "n" symbols of packed key "x" in their right position
+    //
+    bool insert(const uint64_t* x, int xWords, int n);
+    // Returns false if the key was already in the tree
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Joining function, responsible for joining a node with its only child
+    //
+    void join(Node* t);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Removal function, responsible for removing the "n" symbols of packed key "x" from the tree
+    //
+    bool remove(const uint64_t* x, int xWords, int n);
+    // Returns false if the key was not found
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Walking function, responsible for going through node "t" and its whole sub-tree, on an explicit stack rather...
+    // ...than recursively so that long strings cannot overflow the call stack
+    // If "destroy" is true every node is deleted once its children are on the stack, otherwise the packed label...
+    // ...bytes of the nodes are summed up
+    //
+    long long walk(Node* t, bool destroy);
+    // Returns the number of label bytes (0 if destroying)
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Trees cannot be copied, they own their nodes
+    AlphabetRadixTree(const AlphabetRadixTree&);
+    AlphabetRadixTree& operator=(const AlphabetRadixTree&);
+
+public:
+
+    // Basic constructor, initializes root node to an empty node with no children
+    AlphabetRadixTree() : root(new Node(0, 0, 0, 0, false)), stringCount(0), nodeCount(0) {};
+
+    // Destructor, responsible for de-allocating memory occupied by the tree, walking it from the root
+    ~AlphabetRadixTree() { walk(root, true); };
+
+    // Publicly usable functions, names self-explanatory
+    // Strings containing anything outside the alphabet (as well as empty strings) are rejected by "addString"
+    bool addString(const char* str);
+    void deleteString(const char* str);
+    bool searchString(const char* str);
+
+    // Counting functions, O(1), the empty root node is not counted
+    int countStrings() const { return stringCount; }
+    int countNodes() const { return nodeCount; }
+
+    // Number of bytes taken by the packed edge labels of all nodes, walking the whole tree
+    long long labelBytes();
+
+};
+
+// The trees instantiated in "AlphabetRadixTree.cpp"
+typedef AlphabetRadixTree<DNA4> DNARadixTree;
+typedef AlphabetRadixTree<IUPAC> IUPACRadixTree;
+typedef AlphabetRadixTree<Protein20> ProteinRadixTree;
+typedef AlphabetRadixTree<Bytes> ByteRadixTree;
+
+#endif //RADIXTREEPROJECT_ALPHABETRADIXTREE_H
@@ -0,0 +1,237 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdlib>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+using namespace std;
+
+#include "BitVector.h"
+
+// Number of set bits in a word
+static inline int popCount(uint64_t v) {
+#if defined(_MSC_VER)
+    return (int) __popcnt64(v);
+#else
+    return __builtin_popcountll(v);
+#endif
+}
+
+// Index of the lowest set bit of a non-zero word
+static inline int trailingZeros(uint64_t v) {
+#if defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward64(&i, v);
+    return (int) i;
+#else
+    return __builtin_ctzll(v);
+#endif
+}
+
+// Position of the "k"-th set bit of word "v" (which must have more than "k" of them)
+static inline int selectInWord(uint64_t v, int k) {
+
+    // Skip whole bytes first, then clear the lowest set bits one at a time
+    int shift = 0, c;
+    while ((c = popCount((v >> shift) & 0xFF)) <= k) { k -= c; shift += 8; }
+
+    v >>= shift;
+    while (k--) v &= v - 1;
+
+    return shift + trailingZeros(v);
+
+}
+
+BitVector::BitVector() : words(0), bits(0), capacity(0), superRank(0), blockRank(0), blocks(0), selectOne(0),
+                         selectZero(0), ones(0) {}
+
+BitVector::~BitVector() {
+    free(words);
+    free(superRank);
+    free(blockRank);
+    free(selectOne);
+    free(selectZero);
+}
+
+void BitVector::build() {
+
+    // Whole blocks are allocated (the words past the end read as zeros), which keeps every loop below free of...
+    // ...end-of-vector checks
+
+    blocks = (bits + BLOCK_BITS - 1) / BLOCK_BITS;
+    capacity = (blocks ? blocks : 1) * BLOCK_WORDS;
+    words = (uint64_t*) realloc(words, capacity * sizeof(uint64_t));
+    for (uint64_t w = (bits + 63) / 64; w < capacity; w++) words[w] = 0;
+
+    superRank = (uint64_t*) realloc(superRank, (blocks / SUPER_BLOCKS + 2) * sizeof(uint64_t));
+    blockRank = (uint16_t*) realloc(blockRank, (blocks + 1) * sizeof(uint16_t));
+
+    // Rank directory, counting the ones block by block
+
+    ones = 0;
+
+    for (uint64_t b = 0; b <= blocks; b++) {
+
+        if (b % SUPER_BLOCKS == 0) superRank[b / SUPER_BLOCKS] = ones;
+        blockRank[b] = (uint16_t) (ones - superRank[b / SUPER_BLOCKS]);
+
+        if (b == blocks) break;
+        for (int w = 0; w < BLOCK_WORDS; w++) ones += popCount(words[b * BLOCK_WORDS + w]);
+
+    }
+
+    // Select directories, one entry every "SELECT_STEP" ones / zeros, with a last one past the end
+
+    uint64_t zeros = bits - ones;
+
+    selectOne = (uint64_t*) realloc(selectOne, (ones / SELECT_STEP + 2) * sizeof(uint64_t));
+    selectZero = (uint64_t*) realloc(selectZero, (zeros / SELECT_STEP + 2) * sizeof(uint64_t));
+
+    uint64_t nextOne = 0, nextZero = 0;
+
+    for (uint64_t b = 0; b < blocks; b++) {
+
+        // Ones / zeros up to the end of block "b" (zeros past the end of the vector are not counted)
+
+        uint64_t end = b + 1 < blocks ? (b + 1) * BLOCK_BITS : bits;
+        uint64_t o = blockOnes(b + 1), z = end - o;
+
+        while (nextOne * SELECT_STEP < o) selectOne[nextOne++] = b;
+        while (nextZero * SELECT_STEP < z) selectZero[nextZero++] = b;
+
+    }
+
+    selectOne[nextOne] = blocks ? blocks - 1 : 0;
+    selectZero[nextZero] = blocks ? blocks - 1 : 0;
+
+}
+
+uint64_t BitVector::rank1(uint64_t i) const {
+
+    uint64_t b = i / BLOCK_BITS, r = blockOnes(b);
+
+    // Whole words of the block before the one holding bit "i", then the part of that word before it
+
+    const uint64_t* w = words + b * BLOCK_WORDS;
+    int full = (int) (i % BLOCK_BITS) / 64;
+
+    for (int j = 0; j < full; j++) r += popCount(w[j]);
+    if (i % 64) r += popCount(w[full] & ((1ULL << (i % 64)) - 1));
+
+    return r;
+
+}
+
+uint64_t BitVector::findBlock(uint64_t k, bool one) const {
+
+    // The sampled blocks bound the search: the "k"-th one lies between the blocks of the samples around it
+
+    const uint64_t* sample = one ? selectOne : selectZero;
+    uint64_t lo = sample[k / SELECT_STEP], hi = sample[k / SELECT_STEP + 1];
+
+    while (lo < hi) {
+
+        uint64_t mid = (lo + hi + 1) / 2;
+        uint64_t before = one ? blockOnes(mid) : mid * BLOCK_BITS - blockOnes(mid);
+
+        if (before <= k) lo = mid;
+        else hi = mid - 1;
+
+    }
+
+    return lo;
+
+}
+
+uint64_t BitVector::select1(uint64_t k) const {
+
+    uint64_t b = findBlock(k, true);
+    k -= blockOnes(b);
+
+    const uint64_t* w = words + b * BLOCK_WORDS;
+    int j = 0, c;
+
+    while ((uint64_t) (c = popCount(w[j])) <= k) { k -= c; j++; }
+
+    return b * BLOCK_BITS + 64 * j + selectInWord(w[j], (int) k);
+
+}
+
+uint64_t BitVector::select0(uint64_t k) const {
+
+    uint64_t b = findBlock(k, false);
+    k -= b * BLOCK_BITS - blockOnes(b);
+
+    const uint64_t* w = words + b * BLOCK_WORDS;
+    int j = 0, c;
+
+    while ((uint64_t) (c = 64 - popCount(w[j])) <= k) { k -= c; j++; }
+
+    return b * BLOCK_BITS + 64 * j + selectInWord(~w[j], (int) k);
+
+}
+
+uint64_t BitVector::nextOne(uint64_t i) const {
+
+    if (i >= bits) return bits;
+
+    // The bits of the first word before position "i" are cleared, after that whole words are skipped
+
+    uint64_t w = i / 64, v = words[w] & (~0ULL << (i % 64));
+
+    while (!v) {
+        if (++w >= (bits + 63) / 64) return bits;
+        v = words[w];
+    }
+
+    uint64_t p = 64 * w + trailingZeros(v);
+    return p < bits ? p : bits;
+
+}
+
+long long BitVector::bytes() const {
+    return (long long) (capacity * sizeof(uint64_t) + (blocks / SUPER_BLOCKS + 2) * sizeof(uint64_t) +
+                        (blocks + 1) * sizeof(uint16_t) +
+                        ((ones / SELECT_STEP + 2) + ((bits - ones) / SELECT_STEP + 2)) * sizeof(uint64_t));
+}
+
+bool BitVector::write(FILE* file) const {
+
+    uint64_t n = (bits + 63) / 64;
+    return fwrite(&bits, sizeof(bits), 1, file) == 1 && fwrite(words, sizeof(uint64_t), n, file) == n;
+
+}
+
+bool BitVector::read(FILE* file) {
+
+    if (fread(&bits, sizeof(bits), 1, file) != 1) return false;
+
+    // Refuse sizes the rest of the file could not possibly hold before allocating anything for them
+
+    long at = ftell(file);
+    if (at < 0 || fseek(file, 0, SEEK_END) != 0) return false;
+    long end = ftell(file);
+    if (end < at || fseek(file, at, SEEK_SET) != 0) return false;
+
+    uint64_t n = bits / 64 + (bits % 64 != 0);
+    if (n > (uint64_t) (end - at) / sizeof(uint64_t)) return false;
+
+    uint64_t* grown = (uint64_t*) realloc(words, (n ? n : 1) * sizeof(uint64_t));
+    if (!grown) return false;
+    words = grown;
+    capacity = n ? n : 1;
+
+    if (fread(words, sizeof(uint64_t), n, file) != n) return false;
+
+    // Bits past the end must be zeros, or they would be counted as ones by the directories
+    if (bits % 64) words[n - 1] &= (1ULL << (bits % 64)) - 1;
+
+    build();
+    return true;
+
+}
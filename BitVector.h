@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_BITVECTOR_H
+#define RADIXTREEPROJECT_BITVECTOR_H
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+using namespace std;
+
+// Static bit vector with rank and select support, used by "SuccinctRadixIndex"
+//
+// Bits are appended one at a time with "push", then "build" adds the directories that answer, in constant time...
+// ...(rank) or close to it (select):
+//
+// -- rank1(i) / rank0(i):    the number of ones / zeros among the first "i" bits
+// -- select1(k) / select0(k): the position of the "k"-th one / zero, counting from 0
+//
+// Rank directory: the absolute number of ones before every superblock of 65536 bits (64 bits each), and the number...
+// ...before every block of 512 bits relative to its superblock (16 bits each), i.e. a little over 3% on top of the...
+// ...bits themselves. Select directory: the block holding every 8192-th one and zero, so that a select only has to...
+// ...binary search a few blocks, then count its way through at most 8 words.
+//
+class BitVector {
+private:
+
+    static const int BLOCK_BITS = 512;
+    static const int BLOCK_WORDS = BLOCK_BITS / 64;
+    static const int SUPER_BLOCKS = 128;
+    static const int SELECT_STEP = 8192;
+
+    // The bits, bit "i" being bit "i % 64" of word "i / 64", and how many there are
+    uint64_t* words;
+    uint64_t bits;
+    uint64_t capacity;
+
+    // Rank directory, one entry per superblock / block (plus one past the end)
+    uint64_t* superRank;
+    uint16_t* blockRank;
+    uint64_t blocks;
+
+    // Select directory, the block holding the ("SELECT_STEP" * i)-th one / zero (plus one past the end)
+    uint64_t* selectOne;
+    uint64_t* selectZero;
+    uint64_t ones;
+
+    // Number of ones before block "b"
+    uint64_t blockOnes(uint64_t b) const { return superRank[b / SUPER_BLOCKS] + blockRank[b]; }
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Block finding function, responsible for finding the block holding the "k"-th one (or zero if "one" is false)
+    //
+    uint64_t findBlock(uint64_t k, bool one) const;
+    // Returns the index of the last block with at most "k" ones (or zeros) before it
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Bit vectors cannot be copied, they own their arrays
+    BitVector(const BitVector&);
+    BitVector& operator=(const BitVector&);
+
+public:
+
+    // Basic constructor, creates an empty bit vector
+    BitVector();
+
+    // Destructor, de-allocates the bits and the directories
+    ~BitVector();
+
+    // Appends one bit (only before "build")
+    void push(bool bit) {
+        if (bits == capacity * 64) {
+            capacity = capacity ? 2 * capacity : 16;
+            words = (uint64_t*) realloc(words, capacity * sizeof(uint64_t));
+        }
+        if (bits % 64 == 0) words[bits / 64] = 0;
+        words[bits / 64] |= (uint64_t) bit << (bits % 64);
+        bits++;
+    }
+
+    // Trims the bits to their size and builds the rank and select directories, no bits can be pushed afterwards
+    void build();
+
+    uint64_t size() const { return bits; }
+    bool get(uint64_t i) const { return (words[i / 64] >> (i % 64)) & 1; }
+
+    // Rank and select functions, see above; "select" must only be asked for a one / zero that exists
+    uint64_t rank1(uint64_t i) const;
+    uint64_t rank0(uint64_t i) const { return i - rank1(i); }
+    uint64_t select1(uint64_t k) const;
+    uint64_t select0(uint64_t k) const;
+
+    // Position of the first one at or after position "i", or "size()" if there is none
+    uint64_t nextOne(uint64_t i) const;
+
+    // Number of bytes taken by the bits and the directories
+    long long bytes() const;
+
+    // File functions, write the bits to / read them (and rebuild the directories) from an open file
+    // Both return false on a short write / read, "read" also if the size it reads is more than the rest of the file holds
+    bool write(FILE* file) const;
+    bool read(FILE* file);
+
+};
+
+#endif //RADIXTREEPROJECT_BITVECTOR_H
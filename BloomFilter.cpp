@@ -0,0 +1,139 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+using namespace std;
+
+#include "BloomFilter.h"
+
+// Number of set bits in a word
+static inline int popCount(uint64_t v) {
+#if defined(_MSC_VER)
+    return (int) __popcnt64(v);
+#else
+    return __builtin_popcountll(v);
+#endif
+}
+
+// Relaxed atomic access to one word of the filter
+static inline uint64_t loadWord(const uint64_t& w) {
+    return reinterpret_cast<const atomic<uint64_t>&>(w).load(memory_order_relaxed);
+}
+
+static inline void storeWord(uint64_t& w, uint64_t v) {
+    reinterpret_cast<atomic<uint64_t>&>(w).store(v, memory_order_relaxed);
+}
+
+BloomFilter::BloomFilter(long long c, int b) : capacity(c), entries(0), stale(0) {
+
+    bitsPerString = b < 1 ? 1 : b;
+    k = (int) (bitsPerString * 0.6931 + 0.5);
+    if (k < 1) k = 1;
+    if (k > 16) k = 16;
+
+    uint64_t bits = (uint64_t) (capacity > 0 ? capacity : 1) * bitsPerString;
+    blocks = (bits + 64 * BLOCK_WORDS - 1) / (64 * BLOCK_WORDS);
+
+    words = (uint64_t*) calloc(blocks * BLOCK_WORDS, sizeof(uint64_t));
+
+}
+
+BloomFilter::~BloomFilter() {
+    free(words);
+}
+
+uint64_t BloomFilter::hash(const char* s, int n) {
+
+    // Whole words first (read with "memcpy" since "s" need not be aligned), then the last few characters, then a...
+    // ...final mix so that every bit of the hash depends on every character
+
+    const uint64_t M = 0x9E3779B97F4A7C15ULL;
+    uint64_t h = (uint64_t) n * M, w;
+
+    for (; n >= 8; s += 8, n -= 8) {
+        memcpy(&w, s, 8);
+        h = (h ^ w) * M;
+        h ^= h >> 29;
+    }
+
+    if (n) {
+        w = 0;
+        memcpy(&w, s, n);
+        h = (h ^ w) * M;
+    }
+
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+
+    return h;
+
+}
+
+void BloomFilter::add(const char* s, int n) {
+
+    uint64_t h = hash(s, n), *b = block(h), g = h;
+
+    // The bits within the block come 9 at a time from the top of a re-mix of the hash (the best mixed part of a...
+    // ...product), the hash being re-mixed again every 3 bits
+
+    for (int i = 0; i < k; i++) {
+
+        if (i % 3 == 0) g = (g ^ (g >> 31)) * 0x9E3779B97F4A7C15ULL;
+
+        int bit = (int) (g >> (9 * (i % 3) + 37)) & 511;
+        storeWord(b[bit >> 6], loadWord(b[bit >> 6]) | (1ULL << (bit & 63)));
+
+    }
+
+}
+
+bool BloomFilter::mayContain(const char* s, int n) const {
+
+    uint64_t h = hash(s, n), g = h;
+    const uint64_t* b = block(h);
+
+    // Same bits as "add", stopping at the first one that is not set
+
+    for (int i = 0; i < k; i++) {
+
+        if (i % 3 == 0) g = (g ^ (g >> 31)) * 0x9E3779B97F4A7C15ULL;
+
+        int bit = (int) (g >> (9 * (i % 3) + 37)) & 511;
+        if (!((loadWord(b[bit >> 6]) >> (bit & 63)) & 1)) return false;
+
+    }
+
+    return true;
+
+}
+
+double BloomFilter::falsePositiveRate() const {
+
+    // The average over all blocks of the chance that "k" random bits of the block are all set
+
+    double sum = 0;
+
+    for (uint64_t i = 0; i < blocks; i++) {
+
+        int set = 0;
+        for (int w = 0; w < BLOCK_WORDS; w++) set += popCount(loadWord(words[i * BLOCK_WORDS + w]));
+
+        sum += pow(set / (64.0 * BLOCK_WORDS), k);
+
+    }
+
+    return sum / blocks;
+
+}
@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_BLOOMFILTER_H
+#define RADIXTREEPROJECT_BLOOMFILTER_H
+#include <atomic>
+#include <cstdint>
+using namespace std;
+
+// Blocked Bloom filter, used by "RadixTree" to turn most searches for absent strings away before they walk the tree
+//
+// The filter is an array of 512-bit blocks (one cache line each). A string is hashed once: part of the hash picks...
+// ...its block, the rest picks "hashes" bits inside that block, which "add" sets and "mayContain" checks. A string...
+// ...that was added always has all its bits set, so "mayContain" never says no to it; a string that was not added...
+// ...only gets a yes if all its bits happen to be set by others (a false positive). Keeping every bit of a string...
+// ...within one block makes both operations touch a single cache line, at the cost of a slightly higher false...
+// ...positive rate than a plain Bloom filter of the same size.
+//
+// Bits can only be set, never cleared, so removed strings stay in the filter until it is rebuilt ("stale" entries)
+//
+// Bits are read and written through relaxed atomic loads and stores (plain moves on common hardware), so one writer...
+// ...may keep adding while other threads check strings, as in "RadixTree"'s concurrent-read mode
+//
+class BloomFilter {
+private:
+
+    static const int BLOCK_WORDS = 8;
+
+    // The blocks, "BLOCK_WORDS" words each
+    uint64_t* words;
+    uint64_t blocks;
+
+    // Bits set per string, and bits per string the filter was sized with
+    int k;
+    int bitsPerString;
+
+    // Hashing function, mixes the "n" characters of "s" 8 at a time
+    static uint64_t hash(const char* s, int n);
+
+    // Block of hash "h", and the word array of that block
+    uint64_t* block(uint64_t h) const { return words + BLOCK_WORDS * (uint64_t) (((h >> 32) * blocks) >> 32); }
+
+    // Filters cannot be copied, they own their blocks
+    BloomFilter(const BloomFilter&);
+    BloomFilter& operator=(const BloomFilter&);
+
+public:
+
+    // Number of strings the filter was sized for, strings added so far, and how many of those were removed since
+    // The owner keeps "entries" and "stale" up to date and decides when to rebuild a bigger / cleaner filter
+    long long capacity;
+    long long entries;
+    long long stale;
+
+    // Basic constructor, sizes the filter for "capacity" strings at "bitsPerString" bits each, setting...
+    // ..."bitsPerString * ln 2" bits per string (between 1 and 16), which minimizes the false positive rate
+    BloomFilter(long long capacity, int bitsPerString);
+
+    // Destructor, de-allocates the blocks
+    ~BloomFilter();
+
+    // Adds / checks the "n" characters of "s" (the null terminator is NOT part of them)
+    void add(const char* s, int n);
+    bool mayContain(const char* s, int n) const;
+
+    // Bits per string the filter was sized with, and number of bits set per string
+    int bits() const { return bitsPerString; }
+    int hashes() const { return k; }
+
+    // Number of bytes taken by the blocks
+    long long bytes() const { return (long long) (blocks * BLOCK_WORDS * sizeof(uint64_t)); }
+
+    // False positive rate of the filter as it is now, computed from how full each block is: a string that was not...
+    // ...added lands in a block at random, and is let through if its "hashes" bits all hit set ones
+    // It accounts for stale entries and for blocks filling up unevenly, which a formula based on counts alone would not
+    double falsePositiveRate() const;
+
+};
+
+#endif //RADIXTREEPROJECT_BLOOMFILTER_H
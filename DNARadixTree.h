@@ -0,0 +1,25 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_DNARADIXTREE_H
+#define RADIXTREEPROJECT_DNARADIXTREE_H
+using namespace std;
+
+// A Radix Tree specialized for DNA segments (strings made only of the letters A, C, G, T)
+//
+// Edge labels are packed at 2 bits per base, children are dispatched through one pointer per base, and "prefix"...
+// ...compares 32 bases per iteration. It is simply "AlphabetRadixTree" over the "DNA4" alphabet, see...
+// ..."AlphabetRadixTree.h" for the details and for the other alphabets (IUPAC codes, proteins, raw bytes).
+//
+// This is a separate type, not a mode of "RadixTree": "RadixTree" keeps its byte labels and "link" / "next" sibling...
+// ...lists, so its "searchString" / "addString" and everything built on them do not get any faster from the packing...
+// ...or the dispatch. Code that wants them has to use "DNARadixTree" itself, which "RadixTreeBenchmark" times next...
+// ...to "RadixTree" (the rows starting with "DNA").
+//
+#include "AlphabetRadixTree.h"
+
+#endif //RADIXTREEPROJECT_DNARADIXTREE_H
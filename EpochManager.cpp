@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdlib>
+using namespace std;
+
+#include "EpochManager.h"
+
+// Number of retired objects after which the writer tries to free some of them
+static const size_t COLLECT_THRESHOLD = 256;
+
+// Source of the slot each thread tries first, spreading threads over different slots so they rarely have to probe
+static atomic<unsigned int> nextSlotHint(0);
+static thread_local unsigned int slotHint = nextSlotHint++;
+
+EpochManager::ReadGuard::ReadGuard(EpochManager& m) : manager(m) {
+
+    // Announce the epoch we start in by claiming a free slot (a slot holding 0), starting with this thread's own slot
+    // The claim is a sequentially consistent exchange, so it is ordered before every pointer this reader loads later
+
+    unsigned long long e = manager.globalEpoch.load();
+
+    for (unsigned int i = slotHint;; i++) {
+
+        unsigned long long unused = 0;
+        slot = (int) (i % MAX_READERS);
+
+        if (manager.slots[slot].epoch.compare_exchange_strong(unused, e)) break;
+
+    }
+
+}
+
+EpochManager::ReadGuard::~ReadGuard() {
+    manager.slots[slot].epoch.store(0, memory_order_release);
+}
+
+EpochManager::EpochManager(Reclaimer r, void* ctx) : globalEpoch(1), limbo(0), pending(0), capacity(0), reclaimer(r), context(ctx) {
+    for (int i = 0; i < MAX_READERS; i++) slots[i].epoch.store(0);
+}
+
+void EpochManager::retire(void* object) {
+
+    // The object is tagged with the epoch at the time it was retired, which is after it was unlinked
+
+    if (pending == capacity) {
+        capacity = capacity ? 2 * capacity : COLLECT_THRESHOLD;
+        limbo = (Retired*) realloc(limbo, capacity * sizeof(Retired));
+    }
+
+    limbo[pending].object = object;
+    limbo[pending].epoch = globalEpoch.load();
+    pending++;
+
+    if (pending % COLLECT_THRESHOLD == 0) collect();
+
+}
+
+void EpochManager::collect() {
+
+    // Everything retired so far was unlinked before this fence, so a reader announcing itself after the fence...
+    // ...cannot reach any of it, no matter which epoch it read
+
+    atomic_thread_fence(memory_order_seq_cst);
+
+    // Advancing the epoch means that readers starting from now on announce a later epoch than every tag so far
+    unsigned long long safe = ++globalEpoch;
+
+    // An object retired in epoch "r" may still be in use by any reader that announced an epoch <= "r"
+    for (int i = 0; i < MAX_READERS; i++) {
+        unsigned long long e = slots[i].epoch.load();
+        if (e && e < safe) safe = e;
+    }
+
+    // Free every object retired before the oldest active reader started, keeping the others in order
+
+    size_t kept = 0;
+
+    for (size_t i = 0; i < pending; i++) {
+        if (limbo[i].epoch < safe) reclaimer(limbo[i].object, context);
+        else limbo[kept++] = limbo[i];
+    }
+
+    pending = kept;
+
+}
+
+void EpochManager::drain() {
+
+    for (size_t i = 0; i < pending; i++) reclaimer(limbo[i].object, context);
+
+    free(limbo);
+    limbo = 0;
+    pending = capacity = 0;
+
+}
@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_EPOCHMANAGER_H
+#define RADIXTREEPROJECT_EPOCHMANAGER_H
+#include <atomic>
+#include <cstddef>
+using namespace std;
+
+// Epoch-based memory reclamation, letting one writer thread free memory that reader threads might still be looking at
+//
+// Readers wrap every lookup in a "ReadGuard", which announces the global epoch the reader started in. The writer...
+// ...never frees an object it has just unlinked; it "retires" it instead, tagging it with the current epoch. Retired...
+// ...objects are only handed to the reclaimer once every active reader has announced a later epoch, i.e. once no...
+// ...reader could possibly have reached them before they were unlinked.
+//
+// Readers never block and never write to anything shared except their own announcement slot.
+// Only ONE thread may call "retire", "collect" and "drain" (the writer), any number of threads may hold "ReadGuard"s.
+//
+class EpochManager {
+public:
+
+    // Function used to actually free a retired object, "context" is whatever was given to the constructor
+    typedef void (*Reclaimer)(void* object, void* context);
+
+    // Maximum number of readers that may be inside a "ReadGuard" at the same time
+    static const int MAX_READERS = 128;
+
+private:
+
+    // A reader's announcement slot: 0 while the slot is free, otherwise the epoch its reader started in
+    // Each slot is padded to its own cache line so that readers do not keep invalidating each other's slots
+    struct Slot {
+        atomic<unsigned long long> epoch;
+        char padding[64 - sizeof(atomic<unsigned long long>)];
+    };
+
+    // An object waiting to be freed, along with the epoch in which it was retired
+    struct Retired {
+        void* object;
+        unsigned long long epoch;
+    };
+
+    // The global epoch, starting at 1 since 0 marks a free slot
+    atomic<unsigned long long> globalEpoch;
+
+    // Reader announcement slots
+    Slot slots[MAX_READERS];
+
+    // Objects retired but not yet freed, stored in a dynamically resized array ("limbo" list)
+    Retired* limbo;
+    size_t pending;
+    size_t capacity;
+
+    // How to free retired objects
+    Reclaimer reclaimer;
+    void* context;
+
+public:
+
+    // Scoped reader registration, readers must hold one for as long as they dereference anything in the structure
+    class ReadGuard {
+    private:
+        EpochManager& manager;
+        int slot;
+    public:
+        explicit ReadGuard(EpochManager& m);
+        ~ReadGuard();
+    };
+
+    // Basic constructor, takes the function that frees retired objects and its context
+    EpochManager(Reclaimer r, void* ctx);
+
+    // Destructor, frees everything still pending (no reader may be active anymore)
+    ~EpochManager() { drain(); }
+
+    // Retirement function, schedules an already unlinked "object" to be freed once no reader can be looking at it
+    void retire(void* object);
+
+    // Collection function, advances the epoch and frees every retired object that no active reader can still reach
+    void collect();
+
+    // Draining function, frees every retired object right away, only valid while no reader is active
+    void drain();
+
+    // Number of retired objects still waiting to be freed
+    size_t pendingCount() const { return pending; }
+
+};
+
+#endif //RADIXTREEPROJECT_EPOCHMANAGER_H
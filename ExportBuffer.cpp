@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <iostream>
+#include <cstdlib>
+using namespace std;
+
+#include "ExportBuffer.h"
+
+ExportBuffer::ExportBuffer(const char* path, bool e, size_t blockBytes)
+    : file(*path ? fopen(path, "w") : 0), echo(e), data((char*) malloc(blockBytes)), used(0), capacity(blockBytes) {
+
+    // Every write is already a large block, the C library's own buffering would only add a copy
+    if (file) setvbuf(file, 0, _IONBF, 0);
+
+}
+
+ExportBuffer::~ExportBuffer() {
+
+    flush();
+    if (file) fclose(file);
+    if (echo) cout.flush();
+    free(data);
+
+}
+
+void ExportBuffer::writeNumber(long long n) {
+
+    // Digits come out last to first, so they are gathered in a small array before being appended
+
+    char digits[24];
+    int i = sizeof(digits);
+    bool negative = n < 0;
+    unsigned long long u = negative ? 0ULL - (unsigned long long) n : (unsigned long long) n;
+
+    do { digits[--i] = char('0' + u % 10); u /= 10; } while (u);
+    if (negative) digits[--i] = '-';
+
+    write(digits + i, sizeof(digits) - i);
+
+}
+
+void ExportBuffer::writeOut(const char* s, size_t n) {
+
+    if (!n) return;
+
+    // A failed write (e.g. a full disk) stops any further output to the file, as a failed stream would
+    if (file && fwrite(s, 1, n, file) != n) { fclose(file); file = 0; }
+
+    if (echo) cout.write(s, n);
+
+}
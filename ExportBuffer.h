@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_EXPORTBUFFER_H
+#define RADIXTREEPROJECT_EXPORTBUFFER_H
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+using namespace std;
+
+// Output buffer used by the Radix Tree's printing functions
+//
+// Lines are built back to back in one large block, which only gets written out once full (and when the buffer is...
+// ...closed), so writing a line is a couple of "memcpy"s instead of one stream operation per character and a flush...
+// ...per line. The file is written without the C library's own buffering, since the blocks are already large.
+//
+// Output goes to the file at the given path (nowhere if the path is empty or the file cannot be opened) and, if...
+// ...echo is on, to the console as well; both get exactly the same bytes.
+//
+class ExportBuffer {
+private:
+
+    // The output file, NULL if there is none
+    FILE* file;
+
+    // Whether to echo output to the console
+    bool echo;
+
+    // The block being filled, the number of bytes already in it, and its size
+    char* data;
+    size_t used;
+    size_t capacity;
+
+    // Buffers cannot be copied, they own their block and their file
+    ExportBuffer(const ExportBuffer&);
+    ExportBuffer& operator=(const ExportBuffer&);
+
+public:
+
+    // Basic constructor, opens (and truncates) the file at "path" unless "path" is empty
+    ExportBuffer(const char* path, bool echo, size_t blockBytes = 1 << 20);
+
+    // Destructor, writes whatever is left and closes the file
+    ~ExportBuffer();
+
+    // Whether the output goes anywhere at all, if not there is no point building it
+    bool active() const { return file || echo; }
+
+    // Appends the "n" characters of "s" (which may include null characters, written as they are)
+    void write(const char* s, size_t n) {
+        if (used + n > capacity) { flush(); if (n > capacity) { writeOut(s, n); return; } }
+        memcpy(data + used, s, n);
+        used += n;
+    }
+
+    // Appends a null-terminated string, or a single character
+    void write(const char* s) { write(s, strlen(s)); }
+    void put(char c) { if (used == capacity) flush(); data[used++] = c; }
+
+    // Appends the decimal digits of "n"
+    void writeNumber(long long n);
+
+    // Writes out the block to the file (and console) and starts a new one
+    void flush() { writeOut(data, used); used = 0; }
+
+private:
+
+    // Writes "n" bytes straight to the file (and console)
+    void writeOut(const char* s, size_t n);
+
+};
+
+#endif //RADIXTREEPROJECT_EXPORTBUFFER_H
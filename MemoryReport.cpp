@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <iomanip>
+using namespace std;
+
+#include "MemoryReport.h"
+
+Histogram::Histogram() : count(0), sum(0), max(0) {
+    for (int i = 0; i < BUCKETS; i++) bucket[i] = 0;
+}
+
+void Histogram::print(ostream& out, const char* name) const {
+
+    out << name << ": " << count << " values, mean " << fixed << setprecision(2) << mean() << ", max " << max << "\n";
+
+    for (int i = 0; i < BUCKETS; i++) {
+
+        if (!bucket[i]) continue;
+
+        out << setw(6) << i << (i == BUCKETS - 1 ? "+" : " ") << setw(12) << bucket[i]
+            << setw(9) << 100.0 * bucket[i] / count << "%" << "\n";
+
+    }
+
+}
+
+void MemoryReport::print(ostream& out) const {
+
+    long long total = totalBytes();
+    double perString = strings ? 1.0 / strings : 0.0;
+
+    out << "Nodes:            " << nodes << "\n";
+    out << "Strings:          " << strings << "\n";
+    out << "Node bytes:       " << nodeBytes << " (of which unused links: " << unusedLinkBytes << ")" << "\n";
+    out << "Inline labels:    " << inlineLabelBytes << " bytes in nodes (unused: " << unusedInlineBytes << ")" << "\n";
+    out << "Label bytes:      " << labelBytes << "\n";
+    out << "Allocator bytes:  " << allocatorBytes << "\n";
+    if (filterBytes) out << "Filter bytes:     " << filterBytes << "\n";
+    out << "Total bytes:      " << total << " (" << fixed << setprecision(1) << total * perString << " per string)" << "\n";
+    out << "Terminal nodes:   " << terminalDepth.count << " (" << setprecision(2)
+        << (nodes ? 100.0 * terminalDepth.count / nodes : 0.0) << "% of nodes)" << "\n";
+    out << "\n";
+
+    depth.print(out, "Depth");
+    out << "\n";
+
+    fanout.print(out, "Fanout");
+    out << "\n";
+
+    labelLength.print(out, "Label length");
+    out << "\n";
+
+    // Terminal ratio per level, alongside the depth histogram it is relative to
+
+    out << "Terminal ratio per depth:" << "\n";
+
+    for (int i = 0; i < Histogram::BUCKETS; i++) {
+
+        if (!depth.bucket[i]) continue;
+
+        out << setw(6) << i << (i == Histogram::BUCKETS - 1 ? "+" : " ") << setw(12) << terminalDepth.bucket[i]
+            << " / " << setw(12) << depth.bucket[i] << setw(9) << 100.0 * terminalDepth.bucket[i] / depth.bucket[i]
+            << "%" << "\n";
+
+    }
+
+}
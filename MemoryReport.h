@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_MEMORYREPORT_H
+#define RADIXTREEPROJECT_MEMORYREPORT_H
+#include <ostream>
+using namespace std;
+
+// Histogram of small non-negative integers (depths, fanouts, label lengths...)
+//
+// Value "i" is counted in bucket "i", except that every value of "BUCKETS - 1" or more shares the last bucket; the...
+// ...exact mean and maximum are kept on the side, so nothing is lost by the last bucket being shared.
+//
+class Histogram {
+public:
+
+    static const int BUCKETS = 64;
+
+    long long bucket[BUCKETS];
+
+    // Number of values added, their sum and the largest of them
+    long long count;
+    long long sum;
+    int max;
+
+    // Basic constructor, creates an empty histogram
+    Histogram();
+
+    // Adds value "v" (which must not be negative)
+    void add(int v) {
+        bucket[v < BUCKETS - 1 ? v : BUCKETS - 1]++;
+        count++;
+        sum += v;
+        if (v > max) max = v;
+    }
+
+    double mean() const { return count ? (double) sum / count : 0.0; }
+
+    // Prints the histogram, one line per non-empty bucket with its share of all values, titled "name"
+    void print(ostream& out, const char* name) const;
+
+};
+
+// Breakdown of the memory taken by a Radix Tree, as returned by "RadixTree::memoryReport"
+//
+// All byte counts are exact for the tree as it is at the time of the report:
+//
+// -- nodeBytes:       the nodes themselves, "sizeof(Node)" each, short keys stored inside them included
+// -- labelBytes:      the characters of the keys too long to be stored inside their node (null terminators included)
+// -- allocatorBytes:  everything the allocator holds on top of the two above. For a heap-backed tree, the malloc...
+//                     ...header and rounding of every block (read back from the allocator where it can tell,...
+//                     ...estimated otherwise); for an arena-backed tree, granule rounding, recycled blocks waiting in...
+//                     ...free lists, slab headers and the unused end of the current slab
+// -- unusedLinkBytes: the part of "nodeBytes" spent on NULL "link" / "next" pointers (leaves and last siblings),...
+//                     ...which is the linked layout's equivalent of unused child slots in an array-based node
+// -- inlineLabelBytes: the part of "nodeBytes" holding the characters of the keys stored inside their node
+// -- unusedInlineBytes: the part of "nodeBytes" reserved for keys stored inside the node but left unused (all of it...
+//                     ...but the pointer to the key's buffer, for a node whose key is too long to be stored there)
+// -- filterBytes:     the Bloom filter, if the tree has one (see "RadixTree::enableBloomFilter")
+//
+// Nodes retired in concurrent-read mode but not yet reclaimed are no longer part of the tree: they are not counted...
+// ...at all for a heap-backed tree, and only as part of "allocatorBytes" for an arena-backed one
+//
+class MemoryReport {
+public:
+
+    int nodes;
+    int strings;
+
+    long long nodeBytes;
+    long long labelBytes;
+    long long allocatorBytes;
+    long long unusedLinkBytes;
+    long long inlineLabelBytes;
+    long long unusedInlineBytes;
+    long long filterBytes;
+
+    // Everything the tree holds from the system: nodes, labels, allocator overhead and Bloom filter
+    long long totalBytes() const { return nodeBytes + labelBytes + allocatorBytes + filterBytes; }
+
+    // Structure histograms:
+    // -- depth:          level of every node (the top level being 0)
+    // -- fanout:         number of children of every node that has any (i.e. the length of its sibling chain of...
+    //                    ...children), the top level counting as the children of the tree itself
+    // -- labelLength:    key length of every node (null terminator included), wherever the key is stored
+    // -- terminalDepth:  level of every terminal node (i.e. leaf, where a string ends), so that per level, the ratio...
+    //                    ...of terminal nodes is "terminalDepth.bucket[i] / depth.bucket[i]"
+    Histogram depth;
+    Histogram fanout;
+    Histogram labelLength;
+    Histogram terminalDepth;
+
+    // Basic constructor, creates an empty report
+    MemoryReport() : nodes(0), strings(0), nodeBytes(0), labelBytes(0), allocatorBytes(0), unusedLinkBytes(0),
+                     inlineLabelBytes(0), unusedInlineBytes(0), filterBytes(0) {}
+
+    // Prints the breakdown followed by the histograms
+    void print(ostream& out) const;
+
+};
+
+#endif //RADIXTREEPROJECT_MEMORYREPORT_H
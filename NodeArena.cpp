@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdlib>
+using namespace std;
+
+#include "NodeArena.h"
+
+NodeArena::NodeArena(size_t slabBytes) : slabs(0), slabSize(slabBytes), cursor(0), limit(0), reserved(0), used(0) {
+    for (size_t i = 0; i <= MAX_CLASS; i++) freeLists[i] = 0;
+}
+
+void NodeArena::grow(size_t bytes) {
+
+    // Oversized requests get a slab of their own, everything else gets a regular slab
+    size_t size = sizeof(Slab) + (bytes > slabSize ? bytes : slabSize);
+
+    Slab* s = (Slab*) malloc(size);
+    s->prev = slabs;
+    s->size = size;
+    slabs = s;
+
+    // The header is a multiple of the granule, so the usable space right after it is already aligned
+    cursor = (char*) (s + 1);
+    limit = (char*) s + size;
+    reserved += size;
+
+}
+
+void* NodeArena::allocate(size_t bytes) {
+
+    size_t granules = (bytes + GRANULE - 1) / GRANULE;
+    if (!granules) granules = 1;
+
+    // First try to re-use a block of the same size class that was given back earlier
+    if (granules <= MAX_CLASS && freeLists[granules]) {
+
+        void* p = freeLists[granules];
+        freeLists[granules] = *(void**) p;
+        used += granules * GRANULE;
+        return p;
+
+    }
+
+    // Otherwise bump the cursor, starting a new slab if the current one cannot fit the block
+    size_t size = granules * GRANULE;
+    if (size_t(limit - cursor) < size) grow(size);
+
+    void* p = cursor;
+    cursor += size;
+    used += size;
+    return p;
+
+}
+
+void NodeArena::deallocate(void* p, size_t bytes) {
+
+    if (!p) return;
+
+    size_t granules = (bytes + GRANULE - 1) / GRANULE;
+    if (!granules) granules = 1;
+    used -= granules * GRANULE;
+
+    // Blocks larger than the largest size class are simply left alone until their slab is released
+    if (granules > MAX_CLASS) return;
+
+    *(void**) p = freeLists[granules];
+    freeLists[granules] = p;
+
+}
+
+void NodeArena::absorb(NodeArena& other) {
+
+    // Chain the other arena's slabs in front of ours; our cursor keeps pointing into our own current slab
+
+    if (other.slabs) {
+        Slab* last = other.slabs;
+        while (last->prev) last = last->prev;
+        last->prev = slabs;
+        slabs = other.slabs;
+    }
+
+    // Append our free lists to the other arena's ones, so no given-back block is lost
+
+    for (size_t i = 1; i <= MAX_CLASS; i++) {
+
+        if (!other.freeLists[i]) continue;
+
+        void* last = other.freeLists[i];
+        while (*(void**) last) last = *(void**) last;
+        *(void**) last = freeLists[i];
+        freeLists[i] = other.freeLists[i];
+
+        other.freeLists[i] = 0;
+
+    }
+
+    reserved += other.reserved;
+    used += other.used;
+
+    other.slabs = 0;
+    other.cursor = other.limit = 0;
+    other.reserved = other.used = 0;
+
+}
+
+void NodeArena::release() {
+
+    while (slabs) {
+        Slab* prev = slabs->prev;
+        free(slabs);
+        slabs = prev;
+    }
+
+    for (size_t i = 0; i <= MAX_CLASS; i++) freeLists[i] = 0;
+    cursor = limit = 0;
+    reserved = used = 0;
+
+}
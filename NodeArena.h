@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_NODEARENA_H
+#define RADIXTREEPROJECT_NODEARENA_H
+#include <cstddef>
+using namespace std;
+
+// Slab allocator used by the Radix Tree for its nodes and key buffers
+//
+// Memory is carved out of large slabs by simply bumping a cursor, so an allocation is a couple of additions rather...
+// ...than a trip to "malloc". Blocks given back through "deallocate" (e.g. the old key of a split or joined node) are...
+// ...kept in a free list per size class and handed out again before the cursor is bumped any further.
+//
+// Nothing is ever returned to the system one block at a time: "release" frees whole slabs at once, which is what...
+// ...makes clearing or destroying a tree take time proportional to the number of slabs rather than nodes.
+//
+class NodeArena {
+private:
+
+    // Every slab starts with this header, linking it to the previously allocated slab
+    struct Slab {
+        Slab* prev;
+        size_t size;
+    };
+
+    // Block sizes are rounded up to multiples of "GRANULE" bytes, and blocks of up to "MAX_CLASS" granules are recycled
+    static const size_t GRANULE = 8;
+    static const size_t MAX_CLASS = 128;
+
+    // Most recently allocated slab (the one "cursor" points into), and the default size of a new slab
+    Slab* slabs;
+    size_t slabSize;
+
+    // Bump pointer into the current slab, and the end of its usable space
+    char* cursor;
+    char* limit;
+
+    // Heads of the free lists, one per size class; a free block stores the pointer to the next free block in itself
+    void* freeLists[MAX_CLASS + 1];
+
+    // Bookkeeping for memory reports: bytes requested from the system, and bytes currently handed out
+    size_t reserved;
+    size_t used;
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Slab allocation function, responsible for getting a new slab of at least "bytes" usable bytes from the system
+    //
+    void grow(size_t bytes);
+    // ---------------------------------------------------------------------------------------------------------------
+
+public:
+
+    // Basic constructor, no slab is allocated until the first allocation
+    explicit NodeArena(size_t slabBytes = 1 << 20);
+
+    // Destructor, releases all slabs
+    ~NodeArena() { release(); }
+
+    // Allocation function, returns a block of at least "bytes" bytes aligned for any pointer-sized member
+    void* allocate(size_t bytes);
+
+    // De-allocation function, gives back a block of "bytes" bytes previously returned by "allocate" for re-use
+    void deallocate(void* p, size_t bytes);
+
+    // Releases every slab at once, invalidating every block handed out so far
+    void release();
+
+    // Takes over every slab (and free block) of arena "other", which is left empty
+    // Blocks handed out by "other" stay valid, and from now on belong to (and get released with) this arena
+    void absorb(NodeArena& other);
+
+    // Memory accounting, names self-explanatory
+    size_t bytesReserved() const { return reserved; }
+    size_t bytesInUse() const { return used; }
+
+};
+
+#endif //RADIXTREEPROJECT_NODEARENA_H
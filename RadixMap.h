@@ -0,0 +1,450 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_RADIXMAP_H
+#define RADIXTREEPROJECT_RADIXMAP_H
+#include <cstring>
+#include <cstdlib>
+using namespace std;
+
+// A Radix Tree that maps every string it stores to a value of type "V" (e.g. a k-mer or segment counter)
+//
+// It uses the same node layout and prefix / split / join logic as "RadixTree": nodes are linked through...
+// ..."link" (first child) and "next" (sibling, kept in alphabetical order), and a string is stored when a node's key...
+// ...ends with its null terminator. The only addition is that every such leaf carries the string's value, so finding...
+// ...a string is also finding its value: "upsert" and "increment" both do a single descent that either stops at the...
+// ...existing leaf or creates it right where the descent ended.
+//
+// Only leaves hold a value (they are "Leaf" objects, the other nodes plain "Node"s), so internal nodes cost no more...
+// ...than "RadixTree"'s. A leaf keeps its value for as long as its string is in the map: splitting or joining puts a...
+// ...new node above it or takes one away, reshaping the keys, but never moves a value from one node to another.
+//
+// "V" must be default-constructible and copy-assignable ("increment" also needs "+=").
+// The whole class is a template, hence defined entirely in this header.
+//
+template <typename V>
+class RadixMap {
+public:
+
+    // Callback used by "forEach", called once per string (in alphabetical order) with the string, its length (null...
+    // ...terminator NOT included), its value (which may be modified in place) and the caller's "context"; returning...
+    // ...false stops the traversal. The string lives in a buffer re-used for the next one
+    typedef bool (*Visitor)(const char* str, int len, V& value, void* context);
+
+private:
+
+    // Radix Map's private inner class: Node, the same as "RadixTree"'s
+    class Node {
+    public:
+
+        // ---- The "link" node (first child) and the "next" node (sibling)
+        Node* link;
+        Node* next;
+
+        // The key of the node, and its number of characters (null character included - if it exists)
+        char* key;
+        int len;
+
+        // Basic constructor, copies the "n" characters of "k" into a key of its own
+        Node(const char* k, int n) : link(0), next(0), key(new char[n]), len(n) { memcpy(key, k, n); }
+
+        // Basic deconstructor, de-allocates the key only (children and siblings are taken care of by the map)
+        ~Node() { delete[] key; }
+
+        // Whether the node is a leaf, i.e. its key ends with the null terminator, in which case it is really a "Leaf"
+        bool leaf() const { return !key[len - 1]; }
+
+    };
+
+    // A leaf, the node where a string ends, along with the string's value
+    class Leaf : public Node {
+    public:
+
+        V value;
+
+        Leaf(const char* k, int n) : Node(k, n), value() {}
+
+    };
+
+    // De-allocates node "t" as whatever it really is (nodes have no virtual destructor, to keep them small)
+    static void destroy(Node* t) { if (t->leaf()) delete static_cast<Leaf*>(t); else delete t; }
+
+    // Radix Map's root node
+    Node* root;
+
+    // Number of strings and of nodes currently in the map
+    int stringCount;
+    int nodeCount;
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Prefix function, same as "RadixTree::prefix"
+    //
+    static int prefix(const char* x, int n, const char* key, int m);
+    // Returns the number of common prefix characters
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Finder function, responsible for finding the leaf of the "n" characters of "x" (null terminator included)
+    //
+    Leaf* find(const char* x, int n) const;
+    // Returns pointer to the leaf, or NULL if "x" is not in the map
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Splitting function, responsible for splitting the node in "slot" into two at position "k"
+    //
+    // Unlike "RadixTree::split", the first "k" characters go to a new node put in the node's place, and the node...
+    // ...itself (a leaf, with its value, or not) keeps the rest of its key beneath it
+    //
+    void split(Node** slot, int k);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Locating function, responsible for finding the leaf of the "n" characters of "x", inserting it (with a...
+    // ...default-constructed value) right where the descent ends if it is not there yet
+    //
+    Leaf* locate(const char* x, int n, bool& created);
+    // Returns pointer to the leaf, "created" telling whether it was just added
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Joining function, responsible for joining the node in "slot" with its only child
+    //
+    // Unlike "RadixTree::join", the child is the one kept: it takes its parent's key in front of its own and its...
+    // ...parent's place, so a leaf child keeps its value
+    //
+    void join(Node** slot);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Maps cannot be copied, they own their nodes
+    RadixMap(const RadixMap&);
+    RadixMap& operator=(const RadixMap&);
+
+public:
+
+    // Basic constructor, initializes root node to NULL
+    RadixMap() : root(0), stringCount(0), nodeCount(0) {}
+
+    // Destructor, responsible for de-allocating memory occupied by the map
+    ~RadixMap() { clear(); }
+
+    // Clearing function, removes all strings from the map
+    void clear();
+
+    // Publicly usable functions:
+    // -- upsert:     sets the value of "str", adding "str" if needed; returns true if "str" was added
+    // -- get:        returns a pointer to the value of "str" (which may be modified in place), NULL if not in the map
+    // -- increment:  adds "delta" to the value of "str", adding "str" with a default value first if needed; returns...
+    //                ...the new value
+    // -- erase:      removes "str" along with its value; returns false if it was not in the map
+    //
+    bool upsert(const char* str, const V& value);
+    V* get(const char* str) const;
+    V increment(const char* str, const V& delta = V(1));
+    bool erase(const char* str);
+
+    // Counting functions, O(1)
+    int countStrings() const { return stringCount; }
+    int countNodes() const { return nodeCount; }
+
+    // Traversal function, calls "visit" on every string and its value in alphabetical order
+    // Returns the number of strings visited
+    int forEach(Visitor visit, void* context = 0);
+
+};
+
+template <typename V>
+int RadixMap<V>::prefix(const char* x, int n, const char* key, int m) {
+
+    int iterator = 0;
+
+    for (; iterator < n && iterator < m; iterator++)
+        if (x[iterator] != key[iterator]) break;
+
+    return iterator;
+
+}
+
+template <typename V>
+typename RadixMap<V>::Leaf* RadixMap<V>::find(const char* x, int n) const {
+
+    Node* t = root;
+
+    while (t) {
+
+        int k = prefix(x, n, t->key, t->len);
+
+        if (k == 0) {
+            if ((unsigned char) t->key[0] > (unsigned char) x[0]) return 0;
+            t = t->next;
+            continue;
+        }
+
+        // All of "x", terminator included, matched: only a leaf's key holds a terminator
+        if (k == n) return static_cast<Leaf*>(t);
+        if (k != t->len) return 0;
+
+        x += k;
+        n -= k;
+        t = t->link;
+
+    }
+
+    return 0;
+
+}
+
+template <typename V>
+void RadixMap<V>::split(Node** slot, int k) {
+
+    // "ABCDEF null" split at 4 becomes "ABCD" ---- "EF null", where "EF null" is the node that was there (and...
+    // ..."ABCD" a new one), so the value stays where it was
+
+    Node* t = *slot;
+
+    Node* p = new Node(t->key, k);
+    p->next = t->next;
+    p->link = t;
+
+    char* a = new char[t->len - k];
+    memcpy(a, t->key + k, t->len - k);
+
+    delete[] t->key;
+    t->key = a;
+    t->len -= k;
+    t->next = 0;
+
+    *slot = p;
+
+    nodeCount++;
+
+}
+
+template <typename V>
+typename RadixMap<V>::Leaf* RadixMap<V>::locate(const char* x, int n, bool& created) {
+
+    // Same walk as "RadixTree::insert", stopping at the leaf if it already exists
+
+    Node** slot = &root;
+
+    while (Node* t = *slot) {
+
+        int k = prefix(x, n, t->key, t->len);
+
+        if (k == 0) {
+            if ((unsigned char) t->key[0] > (unsigned char) x[0]) break;
+            slot = &t->next;
+            continue;
+        }
+
+        if (k == n) { created = false; return static_cast<Leaf*>(t); }
+
+        // After a split, "slot" holds the new node with the common part, and the descent goes on beneath it
+        if (k < t->len) split(slot, k);
+
+        x += k;
+        n -= k;
+        slot = &(*slot)->link;
+
+    }
+
+    // Not found: the leaf goes right where the descent ended, before whatever sibling comes after it
+
+    Leaf* t = new Leaf(x, n);
+    t->next = *slot;
+    *slot = t;
+
+    stringCount++;
+    nodeCount++;
+
+    created = true;
+    return t;
+
+}
+
+template <typename V>
+void RadixMap<V>::join(Node** slot) {
+
+    // "ABCD" ---- "EF null" becomes "ABCDEF null", where "ABCDEF null" is the child (the value staying where it was)...
+    // ...and "ABCD" is the node that goes away
+
+    Node* t = *slot;
+    Node* p = t->link;
+
+    char* a = new char[t->len + p->len];
+    memcpy(a, t->key, t->len);
+    memcpy(a + t->len, p->key, p->len);
+
+    delete[] p->key;
+    p->key = a;
+    p->len += t->len;
+    p->next = t->next;
+
+    *slot = p;
+
+    delete t;
+    nodeCount--;
+
+}
+
+template <typename V>
+void RadixMap<V>::clear() {
+
+    // Same as "RadixTree::destroyAux": children are spliced in front of the siblings so no recursion is needed
+
+    Node* t = root;
+
+    while (t) {
+
+        if (t->link) {
+            Node* last = t->link;
+            while (last->next) last = last->next;
+            last->next = t->next;
+            t->next = t->link;
+        }
+
+        Node* n = t->next;
+        destroy(t);
+        t = n;
+
+    }
+
+    root = 0;
+    stringCount = nodeCount = 0;
+
+}
+
+template <typename V>
+bool RadixMap<V>::upsert(const char* str, const V& value) {
+
+    bool created;
+    locate(str, (int) strlen(str) + 1, created)->value = value;
+
+    return created;
+
+}
+
+template <typename V>
+V* RadixMap<V>::get(const char* str) const {
+
+    Leaf* t = find(str, (int) strlen(str) + 1);
+    return t ? &t->value : 0;
+
+}
+
+template <typename V>
+V RadixMap<V>::increment(const char* str, const V& delta) {
+
+    bool created;
+    Leaf* t = locate(str, (int) strlen(str) + 1, created);
+
+    t->value += delta;
+    return t->value;
+
+}
+
+template <typename V>
+bool RadixMap<V>::erase(const char* str) {
+
+    // Same walk as "RadixTree::remove", joining the parent with its last remaining child if needed
+
+    const char* x = str;
+    int n = (int) strlen(str) + 1;
+
+    // "parent" is the slot holding the node we came from, which is what joining it needs
+
+    Node** slot = &root;
+    Node** parent = 0;
+
+    while (Node* t = *slot) {
+
+        int k = prefix(x, n, t->key, t->len);
+
+        if (k == n) {
+
+            *slot = t->next;
+            destroy(t);
+
+            if (parent && (*parent)->link && !(*parent)->link->next) join(parent);
+
+            stringCount--;
+            nodeCount--;
+            return true;
+
+        }
+
+        if (k == 0) {
+            if ((unsigned char) t->key[0] > (unsigned char) x[0]) return false;
+            slot = &t->next;
+            continue;
+        }
+
+        if (k != t->len) return false;
+
+        parent = slot;
+        x += k;
+        n -= k;
+        slot = &t->link;
+
+    }
+
+    return false;
+
+}
+
+template <typename V>
+int RadixMap<V>::forEach(Visitor visit, void* context) {
+
+    // Depth-first, on an explicit stack of the nodes still to be visited and where their keys start in the buffer
+    // A node's siblings are pushed before its children, so that the children (which come first) are popped first
+
+    int capacity = 16, top = 0, size = 64, visited = 0;
+    Node** stack = (Node**) malloc(capacity * sizeof(Node*));
+    int* offsets = (int*) malloc(capacity * sizeof(int));
+    char* buffer = (char*) malloc(size);
+
+    if (root) { stack[0] = root; offsets[0] = 0; top = 1; }
+
+    while (top) {
+
+        Node* t = stack[--top];
+        int offset = offsets[top];
+
+        if (offset + t->len > size) {
+            size = 2 * (offset + t->len);
+            buffer = (char*) realloc(buffer, size);
+        }
+
+        memcpy(buffer + offset, t->key, t->len);
+
+        // A leaf's key brings the null terminator
+
+        if (t->leaf()) {
+            visited++;
+            if (!visit(buffer, offset + t->len - 1, static_cast<Leaf*>(t)->value, context)) break;
+        }
+
+        if (top + 2 > capacity) {
+            capacity *= 2;
+            stack = (Node**) realloc(stack, capacity * sizeof(Node*));
+            offsets = (int*) realloc(offsets, capacity * sizeof(int));
+        }
+
+        if (t->next) { stack[top] = t->next; offsets[top] = offset; top++; }
+        if (t->link) { stack[top] = t->link; offsets[top] = offset + t->len; top++; }
+
+    }
+
+    free(stack);
+    free(offsets);
+    free(buffer);
+
+    return visited;
+
+}
+
+#endif //RADIXTREEPROJECT_RADIXMAP_H
@@ -0,0 +1,377 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstring>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+using namespace std;
+
+#include "RadixSnapshot.h"
+
+const char RadixSnapshot::MAGIC[8] = {'R', 'D', 'X', 'S', 'N', 'A', 'P', '1'};
+
+RadixSnapshot::RadixSnapshot(const char* b, size_t s, void* m, bool o) : base(b), size(s), mapping(m), owned(o) {
+    header = (const Header*) base;
+    nodes = (const Record*) (base + sizeof(Header));
+    labels = (const char*) (nodes + header->nodeCount + 2);
+}
+
+// Unmapping function, shared by the destructor and by "open" when it rejects a file
+static void unmapFile(const char* base, size_t size, void* mapping) {
+#ifdef _WIN32
+    UnmapViewOfFile(base);
+    CloseHandle((HANDLE) mapping);
+#else
+    (void) mapping;
+    munmap((void*) base, size);
+#endif
+}
+
+bool RadixSnapshot::valid(const char* b, size_t s) {
+
+    // Check the header and that the node records and label pool it announces actually fit in the block
+
+    const Header* h = (const Header*) b;
+
+    if (s < sizeof(Header) || memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0 || h->byteOrder != ORDER_MARK ||
+        h->version != VERSION || s < sizeof(Header) + ((size_t) h->nodeCount + 2) * sizeof(Record) + h->labelBytes)
+        return false;
+
+    // Then go through the records the way "RadixTree::buildSnapshot" lays them out: the children of every record...
+    // ...come right after those of the record before it (so every record but the virtual root has exactly one...
+    // ...parent, which comes before it), every label but the root's is non-empty and starts where the one before...
+    // ...it ends, the sentinel's being the end of the label pool, and every leaf's label ends with the terminator...
+    // ...that the searches and the iterator rely on
+
+    const Record* r = (const Record*) (b + sizeof(Header));
+    const char* l = (const char*) (r + h->nodeCount + 2);
+    uint64_t total = (uint64_t) h->nodeCount + 1, next = 1;
+
+    if (r[0].label != 0) return false;
+
+    for (uint64_t i = 0; i < total; i++) {
+
+        if (r[i].firstChild != next || (r[i].childCount && r[i].firstChild <= i)) return false;
+
+        next += r[i].childCount;
+        if (next > total) return false;
+
+        if (r[i + 1].label < (uint64_t) r[i].label + (i ? 1 : 0)) return false;
+        if (i && !r[i].childCount && (r[i + 1].label > h->labelBytes || l[r[i + 1].label - 1])) return false;
+
+    }
+
+    return next == total && r[total].firstChild == total && r[total].label == h->labelBytes;
+
+}
+
+RadixSnapshot* RadixSnapshot::open(const char* path) {
+
+    const char* b = 0;
+    size_t s = 0;
+    void* m = 0;
+
+    // Map the whole file read-only
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file == INVALID_HANDLE_VALUE) return 0;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        s = (size_t) fileSize.QuadPart;
+        m = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+        if (m) b = (const char*) MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+        if (m && !b) { CloseHandle(m); m = 0; }
+    }
+
+    CloseHandle(file);
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return 0;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        s = (size_t) st.st_size;
+        void* p = mmap(0, s, PROT_READ, MAP_SHARED, fd, 0);
+        if (p != MAP_FAILED) b = (const char*) p;
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+#endif
+
+    if (!b) return 0;
+
+    if (!valid(b, s)) {
+        unmapFile(b, s, m);
+        return 0;
+    }
+
+    return new RadixSnapshot(b, s, m, false);
+
+}
+
+RadixSnapshot* RadixSnapshot::adopt(char* buffer, size_t size) {
+
+    if (!buffer || !valid(buffer, size)) {
+        free(buffer);
+        return 0;
+    }
+
+    return new RadixSnapshot(buffer, size, 0, true);
+
+}
+
+RadixSnapshot::~RadixSnapshot() {
+    if (owned) free((void*) base); else unmapFile(base, size, mapping);
+}
+
+uint32_t RadixSnapshot::child(uint32_t r, unsigned char c) const {
+
+    // Only the records themselves are read, the first character of every label being stored in its record
+
+    uint32_t lo = nodes[r].firstChild, hi = lo + nodes[r].childCount;
+
+    while (lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if (nodes[mid].first < c) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo < nodes[r].firstChild + nodes[r].childCount && nodes[lo].first == c ? lo : 0;
+
+}
+
+uint32_t RadixSnapshot::findPrefix(const char* p, int m, int& offset) const {
+
+    uint32_t t = 0;
+    offset = 0;
+
+    while (m > 0) {
+
+        uint32_t c = child(t, (unsigned char) *p);
+        if (!c) return 0;
+
+        // Compare the rest of the label (its first character is already known to match) with the rest of "p"
+
+        int len = (int) length(c), k = 1;
+        while (k < len && k < m && labels[nodes[c].label + k] == p[k]) k++;
+
+        // All of "p" matched, within this label or right at its end: every string beneath it starts with "p"
+        if (k == m) return c;
+
+        // The label goes a different way than "p" before "p" ends
+        if (k != len) return 0;
+
+        p += k;
+        m -= k;
+        offset += k;
+        t = c;
+
+    }
+
+    return t;
+
+}
+
+// Searching function, measures the string once then looks it up (null terminator included)
+bool RadixSnapshot::searchString(const char* str) {
+    return searchString(str, (int) strlen(str));
+}
+
+// Explicit-length searching function, the same walk as "RadixTree::find" except that the children of a node are...
+// ...binary searched by their first character rather than visited one by one
+bool RadixSnapshot::searchString(const char* str, int len) {
+
+    const unsigned char* x = (const unsigned char*) str;
+    int n = len + 1;
+
+    uint32_t t = 0;
+
+    while (n > 0) {
+
+        // Find the child whose label starts with the current character, if any
+
+        uint32_t c = child(t, *x);
+        if (!c) return false;
+
+        // The whole label must match for the walk to go on (its first character already does)
+
+        uint32_t l = length(c);
+        if ((uint32_t) n < l || memcmp(labels + nodes[c].label + 1, x + 1, l - 1) != 0) return false;
+
+        x += l;
+        n -= l;
+        t = c;
+
+    }
+
+    // Every character (terminator included) was matched, so the last label ended with the terminator, i.e. a leaf
+    return true;
+
+}
+
+// Prefix counting function, the count of the record where the prefix ends is the answer
+int RadixSnapshot::countWithPrefix(const char* prefix) {
+
+    int m = (int) strlen(prefix), offset;
+
+    uint32_t t = findPrefix(prefix, m, offset);
+    return t || !m ? (int) nodes[t].count : 0;
+
+}
+
+// Prefix scanning function, iterates over the sub-tree of the record where the prefix ends, and nothing else
+int RadixSnapshot::forEachWithPrefix(const char* prefix, Visitor visit, void* context) {
+
+    int m = (int) strlen(prefix), offset, visited = 0;
+
+    uint32_t t = findPrefix(prefix, m, offset);
+    if ((!t && m) || !nodes[t].count) return 0;
+
+    iterator it;
+    it.start(this, t, prefix, offset);
+
+    for (; it != end(); ++it) {
+        visited++;
+        if (!visit(*it, it.length(), context)) break;
+    }
+
+    return visited;
+
+}
+
+// Iteration start function, returns an iterator at the alphabetically first string (or the end iterator if empty)
+RadixSnapshot::iterator RadixSnapshot::begin() const {
+
+    iterator it;
+    if (header->stringCount) it.start(this, 0, 0, 0);
+
+    return it;
+
+}
+
+// Iterator copy constructor, gives the copy its own path and buffer
+RadixSnapshot::iterator::iterator(const iterator& other)
+    : snapshot(0), path(0), ends(0), offsets(0), depth(0), capacity(0), buffer(0), bufferSize(0) {
+    *this = other;
+}
+
+// Iterator assignment, copies the path and the current string
+RadixSnapshot::iterator& RadixSnapshot::iterator::operator=(const iterator& other) {
+
+    if (this == &other) return *this;
+
+    depth = 0;
+    snapshot = other.snapshot;
+
+    for (int i = 0; i < other.depth; i++) push(other.path[i], other.ends[i], other.offsets[i]);
+
+    if (other.depth) {
+        bufferSize = other.bufferSize;
+        buffer = (char*) realloc(buffer, bufferSize);
+        memcpy(buffer, other.buffer, bufferSize);
+    }
+
+    return *this;
+
+}
+
+// Iterator path extension function, grows the path arrays as needed
+void RadixSnapshot::iterator::push(uint32_t r, uint32_t end, int offset) {
+
+    if (depth == capacity) {
+        capacity = capacity ? 2 * capacity : 16;
+        path = (uint32_t*) realloc(path, capacity * sizeof(uint32_t));
+        ends = (uint32_t*) realloc(ends, capacity * sizeof(uint32_t));
+        offsets = (int*) realloc(offsets, capacity * sizeof(int));
+    }
+
+    path[depth] = r;
+    ends[depth] = end;
+    offsets[depth] = offset;
+    depth++;
+
+}
+
+// Iterator start function, lays down whatever comes before record "r" in the buffer then goes down to the first leaf
+// The record has no siblings as far as the iterator is concerned, so iterating never leaves its sub-tree
+void RadixSnapshot::iterator::start(const RadixSnapshot* s, uint32_t r, const char* before, int offset) {
+
+    snapshot = s;
+    depth = 0;
+
+    if (offset > bufferSize) {
+        bufferSize = 2 * offset;
+        buffer = (char*) realloc(buffer, bufferSize);
+    }
+
+    if (offset) memcpy(buffer, before, offset);
+
+    push(r, r + 1, offset);
+    descend();
+
+}
+
+// Iterator descent function, follows the first child of every record (the smallest one) down to a leaf
+void RadixSnapshot::iterator::descend() {
+
+    while (true) {
+
+        uint32_t r = path[depth - 1];
+        int offset = offsets[depth - 1], len = (int) snapshot->length(r);
+
+        if (offset + len > bufferSize) {
+            bufferSize = 2 * (offset + len);
+            buffer = (char*) realloc(buffer, bufferSize);
+        }
+
+        // (The virtual root has an empty label, and nothing to copy)
+        if (len) memcpy(buffer + offset, snapshot->labels + snapshot->nodes[r].label, len);
+
+        // A record without children is a leaf, whose label ends with the null terminator: the string is complete
+
+        const Record& t = snapshot->nodes[r];
+        if (!t.childCount) return;
+
+        push(t.firstChild, t.firstChild + t.childCount, offset + len);
+
+    }
+
+}
+
+// Iterator increment function, moves to the next sibling of the deepest record that has one, then down to its first leaf
+RadixSnapshot::iterator& RadixSnapshot::iterator::operator++() {
+
+    while (depth) {
+
+        if (path[depth - 1] + 1 < ends[depth - 1]) {
+            path[depth - 1]++;
+            descend();
+            return *this;
+        }
+
+        depth--;
+
+    }
+
+    return *this;
+
+}
+
+// Iterator comparison, two iterators are equal if both are at the end or both are at the same leaf
+bool RadixSnapshot::iterator::operator==(const iterator& rhs) const {
+    if (!depth || !rhs.depth) return depth == rhs.depth;
+    return path[depth - 1] == rhs.path[rhs.depth - 1];
+}
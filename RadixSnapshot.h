@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_RADIXSNAPSHOT_H
+#define RADIXTREEPROJECT_RADIXSNAPSHOT_H
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+using namespace std;
+
+// A read-only Radix Tree living in a single contiguous block of memory: either a memory-mapped file written by...
+// ..."RadixTree::save", or a buffer built by "RadixTree::freeze"
+//
+// The block holds no pointers at all, only offsets and indices, so a file can be mapped at any address and searched...
+// ...in place without reading it into memory or rebuilding anything first. Pages are loaded by the OS on first touch,...
+// ...and several processes mapping the same file share the same physical pages through the page cache.
+//
+// Layout (all fields are unsigned integers in the byte order of the machine that wrote the file, since the block is...
+// ...searched in place without converting anything; the header's byte order marker makes a machine of the other...
+// ...byte order reject the file rather than misread it):
+//
+// -- Header:  magic "RDXSNAP1", byte order marker, format version, node count, string count, label pool size
+// -- Nodes:   "nodeCount + 2" records of 16 bytes each, in breadth-first order. Record 0 is a virtual root with an...
+//             ...empty label whose children are the first level of the tree, and the last record is a sentinel that...
+//             ...only marks where the label pool ends. The children of every node are stored next to each other,...
+//             ...sorted by their first character, which every record carries so that they can be binary searched...
+//             ...without touching the label pool. Breadth-first order keeps the top levels of the tree, which every...
+//             ...search goes through, packed together at the start of the block
+// -- Labels:  the keys of all nodes back to back, in the same order as the records (null terminators included,...
+//             ...exactly as "RadixTree" stores them), so the label of a record ends where the next record's starts
+//
+class RadixSnapshot {
+public:
+
+    // Callback used by the scanning function, same as "RadixTree::Visitor"
+    typedef bool (*Visitor)(const char* str, int len, void* context);
+
+    // Header, found at offset 0
+    struct Header {
+        char magic[8];
+        uint32_t byteOrder;
+        uint32_t version;
+        uint32_t nodeCount;
+        uint32_t stringCount;
+        uint32_t labelBytes;
+        uint32_t unused;
+    };
+
+    // Node record, the label starts at "label" in the label pool, and the children are the "childCount" records...
+    // ...starting at index "firstChild". "count" is the number of strings in the node's sub-tree (itself included)...
+    // ...and "first" the first character of the label (0 for the virtual root and the sentinel)
+    struct Record {
+        uint32_t label;
+        uint32_t firstChild;
+        uint32_t count;
+        uint16_t childCount;
+        uint8_t first;
+        uint8_t unused;
+    };
+
+    // Expected header values
+    static const char MAGIC[8];
+    static const uint32_t ORDER_MARK = 0x01020304;
+    static const uint32_t VERSION = 3;
+
+    // Forward iterator over the strings of the snapshot in alphabetical order, working just like "RadixTree::iterator"
+    // The string an iterator points at is only valid until it moves on
+    class iterator {
+    private:
+
+        friend class RadixSnapshot;
+
+        const RadixSnapshot* snapshot;
+
+        // Records from the top level down to the current leaf, the end of the range of siblings each one belongs to...
+        // ...(i.e. where iterating over that level stops), and where each one's label starts in "buffer"
+        uint32_t* path;
+        uint32_t* ends;
+        int* offsets;
+        int depth;
+        int capacity;
+
+        // The current string, built from the labels along "path"
+        char* buffer;
+        int bufferSize;
+
+        // Descends from the last record of "path" to the leftmost leaf beneath it, filling "buffer" on the way
+        void descend();
+
+        // Appends record "r" (whose siblings end at "end", and whose label starts at "offset" in "buffer") to "path"
+        void push(uint32_t r, uint32_t end, int offset);
+
+        // Starts iterating over the sub-tree of record "r", the "offset" characters before it being "before"
+        void start(const RadixSnapshot* s, uint32_t r, const char* before, int offset);
+
+    public:
+
+        // Basic constructor, creates the end iterator
+        iterator() : snapshot(0), path(0), ends(0), offsets(0), depth(0), capacity(0), buffer(0), bufferSize(0) {}
+
+        // Copy constructor and assignment, the copy gets buffers of its own
+        iterator(const iterator& other);
+        iterator& operator=(const iterator& other);
+
+        ~iterator() { free(path); free(ends); free(offsets); free(buffer); }
+
+        // The current string, and its length (null terminator NOT included)
+        const char* operator*() const { return buffer; }
+        int length() const { return offsets[depth - 1] + snapshot->length(path[depth - 1]) - 1; }
+
+        // Moves on to the next string in alphabetical order (or to the end)
+        iterator& operator++();
+        iterator operator++(int) { iterator old(*this); ++*this; return old; }
+
+        bool operator==(const iterator& rhs) const;
+        bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+
+    };
+
+private:
+
+    // The whole block, the platform handle needed to unmap it (only used on Windows), and whether the block is a...
+    // ...buffer owned by the snapshot (to be freed) rather than a mapped file (to be unmapped)
+    const char* base;
+    size_t size;
+    void* mapping;
+    bool owned;
+
+    // Views into the block
+    const Header* header;
+    const Record* nodes;
+    const char* labels;
+
+    // Only "open" and "adopt" create snapshots, after checking that the block is a valid one
+    RadixSnapshot(const char* b, size_t s, void* m, bool o);
+
+    // Snapshots cannot be copied, they own their block
+    RadixSnapshot(const RadixSnapshot&);
+    RadixSnapshot& operator=(const RadixSnapshot&);
+
+    // Checks that the block of "s" bytes at "b" starts with a valid header, holds everything the header announces, and...
+    // ...that its records form a tree whose children and labels all stay within the block, so that a corrupted file...
+    // ...is rejected rather than searched outside of its mapping. This goes through every record once
+    static bool valid(const char* b, size_t s);
+
+    // Number of characters in the label of record "r"
+    uint32_t length(uint32_t r) const { return nodes[r + 1].label - nodes[r].label; }
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Child finding function, responsible for binary searching the children of record "r" for the one whose label...
+    // ...starts with character "c"
+    //
+    uint32_t child(uint32_t r, unsigned char c) const;
+    // Returns the index of that child, or 0 (the virtual root, which is nobody's child) if there is none
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Prefix finder function, same as "RadixTree::findPrefix"
+    //
+    uint32_t findPrefix(const char* p, int m, int& offset) const;
+    // Returns the index of the record under which all the strings starting with "p" are stored (the virtual root if...
+    // ..."m" is 0), or 0 if there is none while "m" is not 0
+    // ---------------------------------------------------------------------------------------------------------------
+
+public:
+
+    // Opening function, maps the file at "path" read-only
+    // Returns NULL if the file cannot be opened / mapped, or is not a valid snapshot
+    static RadixSnapshot* open(const char* path);
+
+    // Adopting function, takes over the "malloc"-ed block "buffer" of "size" bytes, which is freed along with the...
+    // ...snapshot (or right away, if it is not a valid snapshot)
+    // Returns NULL if the block is not a valid snapshot
+    static RadixSnapshot* adopt(char* buffer, size_t size);
+
+    // Destructor, unmaps the file or frees the buffer
+    ~RadixSnapshot();
+
+    // Publicly usable functions, names self-explanatory, they work exactly like their "RadixTree" counterparts
+    bool searchString(const char* str);
+    bool searchString(const char* str, int len);
+    int countStrings() const { return (int) header->stringCount; }
+    int countNodes() const { return (int) header->nodeCount; }
+
+    // Prefix scan functions, same as "RadixTree::countWithPrefix" and "RadixTree::forEachWithPrefix"
+    // Counting is O(length of "prefix") thanks to the per-record string counts
+    int countWithPrefix(const char* prefix);
+    int forEachWithPrefix(const char* prefix, Visitor visit, void* context = 0);
+
+    // Iteration over all strings in alphabetical order
+    iterator begin() const;
+    iterator end() const { return iterator(); }
+
+};
+
+#endif //RADIXTREEPROJECT_RADIXSNAPSHOT_H
@@ -6,11 +6,156 @@
 // https://kukuruku.co/post/radix-trees/
 //----------------------------------------------------------------------------------------------------------------------
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <thread>
 using namespace std;
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
 #include "RadixTree.h"
+#include "RadixSnapshot.h"
+#include "SuccinctRadixIndex.h"
+
+// Hot-path counter update, compiled out entirely unless "RADIXTREE_STATS" is defined (see "RadixTree::Stats")
+#ifdef RADIXTREE_STATS
+#define RADIXTREE_COUNT(counter, amount) (counters.counter += (amount))
+#else
+#define RADIXTREE_COUNT(counter, amount) ((void) 0)
+#endif
+
+// Prefetching function, asks for the cache line at "p" to be loaded without waiting for it (a hint, never a fault)
+static inline void prefetch(const void* p) {
+#if defined(_MSC_VER)
+    _mm_prefetch((const char*) p, _MM_HINT_T0);
+#else
+    __builtin_prefetch(p);
+#endif
+}
+
+char* RadixTree::allocateKey(int n) {
+    RADIXTREE_COUNT(allocations, 1);
+    RADIXTREE_COUNT(bytesAllocated, n);
+    return arena ? (char*) arena->allocate(n) : new char[n];
+}
+
+void RadixTree::deallocateKey(char* key, int n) {
+    RADIXTREE_COUNT(deallocations, 1);
+    RADIXTREE_COUNT(bytesFreed, n);
+    if (arena) arena->deallocate(key, n); else delete[] key;
+}
+
+RadixTree::Node* RadixTree::createNode(const char* x, int n) {
+
+    // Short keys are copied into the node itself, longer ones into a freshly allocated key, around which the node is...
+    // ...then constructed. For arena-backed trees the node is constructed in place ("placement new") inside a block...
+    // ...taken from the arena
+
+    Node* t = createNodeWithKey(n <= Node::INLINE_KEY ? 0 : allocateKey(n), n);
+    memcpy(t->key(), x, n);
+
+    return t;
+
+}
+
+RadixTree::Node* RadixTree::createNodeWithKey(char* key, int n) {
+
+    nodeCount++;
+    RADIXTREE_COUNT(allocations, 1);
+    RADIXTREE_COUNT(bytesAllocated, sizeof(Node));
+
+    return arena ? new (arena->allocate(sizeof(Node))) Node(key, n) : new Node(key, n);
+
+}
+
+void RadixTree::replaceKey(Node* t, const char* x, int n) {
+
+    // The old key's buffer (if any) is kept aside first, since storing a short key in the node overwrites the pointer
+    // "memmove" rather than "memcpy", as a short key may be moved within the node's own label
+
+    char* old = t->inlineKey() ? 0 : t->storage.heap;
+    int oldLen = t->len;
+
+    if (n <= Node::INLINE_KEY) memmove(t->storage.label, x, n);
+    else { char* a = allocateKey(n); memcpy(a, x, n); t->storage.heap = a; }
+
+    t->len = n;
+
+    if (old) deallocateKey(old, oldLen);
+
+}
+
+void RadixTree::destroyNode(Node* t) {
+
+    if (!t->inlineKey()) deallocateKey(t->key(), t->len);
+
+    RADIXTREE_COUNT(deallocations, 1);
+    RADIXTREE_COUNT(bytesFreed, sizeof(Node));
+
+    // Nodes hold nothing but pointers and plain values, so there is nothing to destruct before giving the block back
+    if (arena) arena->deallocate(t, sizeof(Node)); else delete t;
+
+}
 
-int RadixTree::prefix(char* x, int n, char* key, int m) {
+void RadixTree::retireNode(Node* t) {
+
+    nodeCount--;
+    if (epochs) epochs->retire(t); else destroyNode(t);
+
+}
+
+void RadixTree::reclaimNode(void* node, void* tree) {
+    ((RadixTree*) tree)->destroyNode((Node*) node);
+}
+
+RadixTree::Node* RadixTree::cloneAux(const Node* t) {
+
+    // Siblings are copied in a loop while children are copied recursively, so recursion depth is the tree's height
+
+    Node* head = 0;
+    Node** slot = &head;
+
+    for (; t; t = t->next) {
+        *slot = createNode(t->key(), t->len);
+        (*slot)->count = t->count;
+        (*slot)->link = cloneAux(t->link);
+        slot = &(*slot)->next;
+    }
+
+    return head;
+
+}
+
+void RadixTree::destroyAux(Node* t) {
+
+    // Rather than recursing, every node's children are spliced in front of its siblings before it is destroyed,...
+    // ...so the whole tree gets consumed as one long sibling list
+
+    while (t) {
+
+        if (t->link) {
+            Node* last = t->link;
+            while (last->next) last = last->next;
+            last->next = t->next;
+            t->next = t->link;
+        }
+
+        Node* n = t->next;
+        destroyNode(t);
+        t = n;
+
+    }
+
+}
+
+int RadixTree::prefix(const char* x, int n, const char* key, int m) {
 
     // This function iterates over the two character arrays, comparing the value of each character every iteration.
     // This comparison loop will terminate in one of three situations:
@@ -24,775 +169,1922 @@ int RadixTree::prefix(char* x, int n, char* key, int m) {
     for (; iterator < n && iterator < m; iterator++)
         if (x[iterator] != key[iterator]) break;
 
+    // Every character up to the first mismatch was compared, the mismatching one included (if there was one)
+    RADIXTREE_COUNT(prefixBytes, iterator < n && iterator < m ? iterator + 1 : iterator);
+
     return iterator;
 
-}
+}
+
+RadixTree::Node* RadixTree::find(const char* x, int n) {
+
+    // "n" is the size of "x" INCLUDING the null character (i.e. size of "abc" is 4), which is consistent with the...
+    // ...expected value of the "len" member of each node: number of characters, null included
+
+    // every link is read through "acquire", so that a concurrent reader only ever sees fully built nodes
+
+    Node* t = acquire(root);
+
+    RADIXTREE_COUNT(lookups, 1);
+
+    // if tree node "t" is null, then there is nothing to be found, we have reached the end of this branch
+
+    while (t) {
+
+        // otherwise, find the common prefix between the node and the key being searched for, "x"
+
+        int k = prefix(x, n, t->key(), t->len);
+        RADIXTREE_COUNT(nodesVisited, 1);
+
+        // if there's nothing in common, repeat the process for the next node in this tree level, unless the siblings...
+        // ...(kept in alphabetical order) are already past the first character of "x"
+
+        if (k == 0) {
+            if ((unsigned char) t->key()[0] > (unsigned char) x[0]) return 0;
+            RADIXTREE_COUNT(siblingHops, 1);
+            t = acquire(t->next);
+            continue;
+        }
+
+        // if all of "x" is prefix, this means the current node IS "x" itself, so return it
+
+        if (k == n) return t;
+
+        // if the entirety of the current node is a prefix itself...
+        // this means that the string we're looking for could span more than one node...
+        // therefore, continue searching for the remaining part of the searched-for value... how?
+        // go to the node that links this tree level to the next level, a.k.a. t->link, and inside it...
+        // "x + k" makes us skip ahead the prefix found and search for the rest of the string, meanwhile...
+        // "n - k" is the size of the rest of the string.
+
+        if (k != t->len) return 0;
+
+        x += k;
+        n -= k;
+        t = acquire(t->link);
+
+    }
+
+    return 0;
+
+}
+
+RadixTree::Node* RadixTree::split(Node** slot, int k) {
+
+    // Let's use the following example to explain this function:
+
+    // Split the following node at position 4:  [parent ---- "ABCDEF null" ---- child]
+    // Required Result:                         [parent ---- "ABCD" ---- "EF null" ---- child]
+
+    Node* t = *slot;
+
+    RADIXTREE_COUNT(splits, 1);
+
+    // Create a node that carries everything after the first "k" characters in the current node
+
+    Node* p = createNode(t->key() + k, t->len - k); // In our example, this means: p = "EF null"
+
+    // Both halves hold exactly the same strings beneath them, so the new node takes the current node's count as it is
+
+    p->count = t->count;
+
+    // Set this newly created node's link/child node as the current one's (maintaining sequentiality)
+
+    p->link = t->link; // In our example, this means: p = "EF null" ---- child
+
+    // In concurrent-read mode, a reader may be in the middle of reading the current node, so instead of modifying it...
+    // ...we build its replacement "ABCD" aside, then swap it into the slot with a single store and retire the original
+
+    if (epochs) {
+
+        Node* h = createNode(t->key(), k);
+        h->count = t->count;
+        h->link = p;
+        h->next = t->next;
+
+        publish(*slot, h);
+        retireNode(t);
+
+        return h;
+
+    }
+
+    // Set the current node's link/child as the newly created node
+
+    t->link = p; // In our example, this means: t = "ABCDEF null" ---- "EF null" ---- child
+
+    // Now keep only the first "k" characters as the key, which moves them into the node itself if they are few enough...
+    // ...(and, if the key already was in the node, simply shortens it), then gives back the old key's buffer if any
+
+    replaceKey(t, t->key(), k);
+
+    // In our example, this means: t = "ABCD" ---- "EF null" ---- child
+    // Successfully splitting the node at position 4.
+
+    return t;
+
+}
+
+bool RadixTree::insert(const char* x, int n) {
+
+    // "slot" always points at the pointer that leads to the current tree node "t", i.e. either "root", the "link" of...
+    // ...the node we descended from, or the "next" of the sibling we just skipped
+
+    Node** slot = &root;
+
+    // the whole key is kept aside, in case the counts updated along the way need to be undone
+
+    const char* x0 = x;
+    int n0 = n;
+
+    RADIXTREE_COUNT(insertions, 1);
+
+    while (Node* t = *slot) {
+
+        // find the common prefix between the current node and the key to be inserted, "x"
+        // the prefix function is provided the size of both character arrays INCLUDING the null character
+
+        int k = prefix(x, n, t->key(), t->len);
+        RADIXTREE_COUNT(nodesVisited, 1);
+
+        // if there's nothing in common, attempt to insert the node to be inserted in the "next" node of the current node
+        // siblings are kept in alphabetical order of their first character, so once a sibling comes after "x" there...
+        // ...is no point looking any further, the new node goes right before it
+
+        if (k == 0) {
+            if ((unsigned char) t->key()[0] > (unsigned char) x[0]) break;
+            RADIXTREE_COUNT(siblingHops, 1);
+            slot = &t->next;
+            continue;
+        }
+
+        // if k = n, the node to be added is the current node itself, so there is nothing left to do except undoing...
+        // ...the counts incremented on the way down, since no string was actually added
+
+        if (k == n) { adjustCounts(x0, n0, -1); return false; }
+
+        // otherwise, part of the current node is a prefix of the key to be added...
+        // observe the following examples of current nodes for key ABCF-null:
+        // 1. current node: ABCDE-null,    ... k < n (3 < 5)
+        // 2. current node: ABC-null,      ... k < n (3 < 5)
+        // 3. current node: ABCF,          ... k < n (4 < 5)
+        // 4. current node: ABCF-null,     ... k = n (5 = 5) (handled above)
+
+        // if the node is larger, split it
+        // -- this applies to example 1, where "ABCDE-null" would be split into "ABC|DE-null".
+        // -- this also applies to example 2, where "ABC-null" would actually be split into "ABC|null"
+        // -- however in case of example 3, the current node size is actually equal to the prefix, so no split
+
+        if (k < t->len) t = split(slot, k);
+
+        // the new string will end up beneath this node, so it counts towards the node's sub-tree
+
+        t->count++;
+
+        // at this point, we continue with what remains after the prefix (aka the "F") among the current node's links
+
+        x += k;
+        n -= k;
+        slot = &t->link;
+
+        // for example 1, this gives us "ABC-DE-null" and "ABC-F-null" as two new children, but no "ABC-null"
+        // for example 2, this gives us "ABC-null" and "ABC-F-null" as the two children.
+        // for example 3, we only get "ABCF-null"
+    }
+
+    // we've reached our insertion point, hence create the node, place it before whatever sibling the slot leads to...
+    // ...(if any), and publish it right there
+
+    Node* t = createNode(x, n);
+    t->count = 1;
+    t->next = *slot;
+    publish(*slot, t);
+
+    stringCount++;
+    return true;
+
+}
+
+void RadixTree::join(Node** slot) {
+
+    // Let's use the following example to explain this function:
+
+    // Join the following node (with its link): [parent ---- "ABCD" ---- "EF null" ---- child]
+    // Required Result:                         [parent ---- "ABCDEF null" ---- child]
+
+    Node* t = *slot;
+
+    RADIXTREE_COUNT(joins, 1);
+
+    // Point towards the link node of the current node
+
+    Node* p = t->link; // In our example, this means: p = "EF null"
+
+    // The joined key holds the current node's characters followed by the link node's ones
+
+    int n = t->len + p->len;
+
+    // In concurrent-read mode, the joined node is built aside and swapped into the slot with a single store, then...
+    // ...both of the original nodes are retired, since readers may still be in the middle of either of them
+
+    if (epochs) {
+
+        Node* j = createNodeWithKey(n <= Node::INLINE_KEY ? 0 : allocateKey(n), n);
+        memcpy(j->key(), t->key(), t->len);
+        memcpy(j->key() + t->len, p->key(), p->len);
+
+        j->count = t->count;
+        j->link = p->link;
+        j->next = t->next;
+
+        publish(*slot, j);
+        retireNode(t);
+        retireNode(p);
+
+        return;
+
+    }
+
+    // If the joined key still fits in the node, the current key is necessarily stored there already (being shorter),...
+    // ...so the link node's characters are simply appended to it
+
+    if (n <= Node::INLINE_KEY) memcpy(t->storage.label + t->len, p->key(), p->len);
+
+    else {
+
+        // Otherwise create a character array to store the current node as well as the link node's characters
+
+        char* a = allocateKey(n);
+        memcpy(a, t->key(), t->len); // a = "ABCD"
+        memcpy(a + t->len, p->key(), p->len); // a = "ABCDEF null"
+
+        // Delete the current key (unless it was stored in the node) and replace it with the character array just created
+
+        if (!t->inlineKey()) deallocateKey(t->storage.heap, t->len);
+        t->storage.heap = a;
+
+    }
+
+    // Increase its size by the size of the link node
+
+    t->len = n;
+
+    // Set the link of the current node as the link of its own link node (i.e. skipping it)
+
+    t->link = p->link; // In our example, this means: t = "ABCDEF null" ---- child
+
+    // Finally, delete the now-duplicated node (only the node itself, its child now belongs to "t")
+
+    retireNode(p);
+
+}
+
+bool RadixTree::remove(const char* x, int n) {
+
+    // "slot" points at the pointer that leads to the current tree node, just like in "insert"
+    // "parent" is the slot of the node whose links we are currently visiting (NULL while still at the root level)
+
+    Node** slot = &root;
+    Node** parent = 0;
+
+    // the whole key is kept aside, in case the counts updated along the way need to be undone
+
+    const char* x0 = x;
+    int n0 = n;
+
+    RADIXTREE_COUNT(removals, 1);
+
+    // if the current tree node is null, then there is nothing to be removed
+
+    while (Node* t = *slot) {
+
+        // find the common prefix between the current node and the key being searched for, "x"
+
+        int k = prefix(x, n, t->key(), t->len);
+        RADIXTREE_COUNT(nodesVisited, 1);
+
+        // if all of "x" is prefix, this means the current node IS "x" itself, so remove it (by replacing it with its next)
+
+        if (k == n)
+        {
+            publish(*slot, t->next);
+            retireNode(t);
+
+            // accordingly, if the parent ends up with only one link (which we can find by seeing if its link has a...
+            // ...next or not), merge it with that link so as to make it one node. The parent is the only node whose...
+            // ...number of links may have changed, so no other node on the way down needs to be checked
+
+            if (parent && (*parent)->link && !(*parent)->link->next) join(parent);
+
+            stringCount--;
+            return true;
+        }
+
+        // if there's nothing in common, repeat the process for the next node in this tree level
+
+        if (k == 0) { RADIXTREE_COUNT(siblingHops, 1); slot = &t->next; continue; }
+
+        // otherwise if the current node is a prefix itself... for example...
+        // key: ABCDE-null
+        // current node: ABC
+
+        // then: k = 3, t->len = 3, n = 6
+
+        // proceed to the link(s) of this node with the rest of the key (in this case, DE-null), attempting to remove again
+
+        if (k != t->len) break;
+
+        // the string being removed would be beneath this node, so it no longer counts towards the node's sub-tree
+
+        t->count--;
+
+        parent = slot;
+        x += k;
+        n -= k;
+        slot = &t->link;
+
+    }
+
+    // otherwise, the node to be removed was not found, so the tree stays as it is (i.e. no changes)...
+    // ...except for the counts decremented on the way down, which get restored
+
+    adjustCounts(x0, n0, +1);
+    return false;
+
+}
+
+RadixTree::Node* RadixTree::buildLevel(const char* const* s, int lo, int hi, int depth, BuildFrame* stack, int& top) {
+
+    // The strings are sorted, so the ones sharing the same character at position "depth" form consecutive groups,...
+    // ...and each group becomes one sibling. Walking the groups in order leaves the siblings in alphabetical order
+
+    Node* head = 0;
+    Node** slot = &head;
+
+    for (int a = lo, b; a < hi; a = b) {
+
+        char c = s[a][depth];
+        for (b = a + 1; b < hi && s[b][depth] == c; b++);
+
+        const char* first = s[a] + depth;
+        Node* t;
+
+        if (b - a == 1) {
+
+            // A group of a single string is a leaf holding everything that is left of it, null terminator included
+
+            int n = 0;
+            while (first[n++]);
+
+            t = createNode(first, n);
+            t->count = 1;
+
+        } else {
+
+            // Otherwise the node's key is the longest common prefix of the group, which (the group being sorted) is...
+            // ...simply the common prefix of its first and last strings. It never includes a null terminator, since...
+            // ...no two strings are equal
+
+            const char* last = s[b - 1] + depth;
+            int k = 0;
+            while (first[k] == last[k]) k++;
+
+            t = createNode(first, k);
+            t->count = b - a;
+
+            stack[top].node = t;
+            stack[top].lo = a;
+            stack[top].hi = b;
+            stack[top].depth = depth + k;
+            top++;
+
+        }
+
+        *slot = t;
+        slot = &t->next;
+
+    }
+
+    return head;
+
+}
+
+void RadixTree::graft(Node* sub, int nodes) {
+
+    // Walk down with the key of "sub" exactly like "insert" would, except that a whole sub-tree is being added
+
+    Node** slot = &root;
+    int offset = 0;
+
+    while (Node* t = *slot) {
+
+        int k = prefix(sub->key() + offset, sub->len - offset, t->key(), t->len);
+
+        if (k == 0) { slot = &t->next; continue; }
+
+        // The node shares only part of its key with "sub" (e.g. buckets "ACGT" and "ACTA" under a node "ACGTAA")
+        if (k < t->len) t = split(slot, k);
+
+        // Every string of "sub" ends up beneath this node
+        t->count += sub->count;
+
+        offset += k;
+        slot = &t->link;
+
+    }
+
+    // The characters already covered by the nodes above are cut off the front of the sub-tree's top key
+
+    if (offset) {
+
+        replaceKey(sub, sub->key() + offset, sub->len - offset);
+
+    }
+
+    publish(*slot, sub);
+
+    nodeCount += nodes;
+    stringCount += sub->count;
+
+}
+
+RadixTree::Node* RadixTree::findPrefix(const char* p, int m, int& offset) {
+
+    // Same walk as "find", except that "p" has no null terminator and may end in the middle of a node's key
+
+    Node* t = root;
+    offset = 0;
+
+    if (!m) return root;
+
+    while (t) {
+
+        int k = prefix(p, m, t->key(), t->len);
+
+        if (k == 0) {
+            if ((unsigned char) t->key()[0] > (unsigned char) p[0]) return 0;
+            t = t->next;
+            continue;
+        }
+
+        // All of "p" matched, within this node's key or right at its end: every string beneath it starts with "p"
+        if (k == m) return t;
+
+        // The node's key goes a different way than "p" before "p" ends
+        if (k != t->len) return 0;
+
+        p += k;
+        m -= k;
+        offset += k;
+        t = t->link;
+
+    }
+
+    return 0;
+
+}
+
+int RadixTree::approximateSearch(const char* query, int k, bool edit, Visitor visit, void* context) {
+
+    int m = (int) strlen(query), found = 0;
+    if (!root || k < 0) return found;
+
+    // Every stack entry is a node still to be visited along with the state right before its key: the length of the...
+    // ...path above it, the mismatches so far (Hamming), and in "rows" (edit) the table row for that path, where...
+    // ..."row[j]" is the edit distance between the path and the first "j" characters of "query". Cells further than...
+    // ..."k" from the diagonal are never read, as their distance is known to exceed "k" anyway
+    //
+    // Siblings share their parent's state, so a node's entry is simply handed over to its next sibling when popped
+
+    struct Frame {
+        Node* node;
+        int depth;
+        int mismatches;
+    };
+
+    int capacity = 16, top = 0, size = 64;
+    Frame* stack = (Frame*) malloc(capacity * sizeof(Frame));
+    int** rows = (int**) malloc(capacity * sizeof(int*));
+    int* scratch = edit ? (int*) malloc((m + 1) * sizeof(int)) : 0;
+    char* path = (char*) malloc(size);
+
+    for (int i = 0; i < capacity; i++) rows[i] = edit ? (int*) malloc((m + 1) * sizeof(int)) : 0;
+
+    stack[0].node = root;
+    stack[0].depth = stack[0].mismatches = 0;
+    if (edit) for (int j = 0; j <= m && j <= k; j++) rows[0][j] = j;
+    top = 1;
+
+    bool stop = false;
+
+    while (top && !stop) {
+
+        Frame f = stack[--top];
+        Node* t = f.node;
+
+        // The next sibling takes over this entry (and its row, which stays where it is)
+
+        if (t->next) { stack[top].node = t->next; top++; }
+
+        if (top == capacity) {
+            capacity *= 2;
+            stack = (Frame*) realloc(stack, capacity * sizeof(Frame));
+            rows = (int**) realloc(rows, capacity * sizeof(int*));
+            for (int i = top; i < capacity; i++) rows[i] = edit ? (int*) malloc((m + 1) * sizeof(int)) : 0;
+        }
+
+        // The state after this node's key is built in the next free entry, starting from the state before it
+
+        if (edit && t->next) memcpy(rows[top], rows[top - 1], (m + 1) * sizeof(int));
+
+        if (f.depth + t->len > size) {
+            size = 2 * (f.depth + t->len);
+            path = (char*) realloc(path, size);
+        }
+
+        int depth = f.depth, mismatches = f.mismatches;
+        bool alive = true;
+
+        for (int i = 0; i < t->len && alive; i++) {
+
+            char c = t->key()[i];
+            path[depth] = c;
+
+            // The null terminator: a string ends here, so check how far it is from the whole query
+
+            if (c == 0) {
+
+                bool match = edit ? (depth - m <= k && m - depth <= k && rows[top][m] <= k) : (depth == m && mismatches <= k);
+
+                if (match) {
+                    found++;
+                    if (visit && !visit(path, depth, context)) stop = true;
+                }
+
+                break;
+
+            }
+
+            depth++;
+
+            if (!edit) {
+
+                // Strings longer than the query can never match, and neither can anything past "k" mismatches
+                if (depth > m || (c != query[depth - 1] && ++mismatches > k)) alive = false;
+                continue;
+
+            }
+
+            // One more row of the edit distance table, limited to the band |depth - j| <= k
+
+            int* old = rows[top];
+            int lo = depth - k > 0 ? depth - k : 0, hi = depth + k < m ? depth + k : m, best = k + 1;
+
+            for (int j = lo; j <= hi; j++) {
+
+                // "old" is the row for "depth - 1", whose band is |depth - 1 - j| <= k
+                int d = j <= depth - 1 + k ? old[j] + 1 : k + 1;
+                if (j > 0 && j - 1 >= depth - 1 - k) {
+                    int diagonal = old[j - 1] + (query[j - 1] != c);
+                    if (diagonal < d) d = diagonal;
+                }
+                if (j > lo && scratch[j - 1] + 1 < d) d = scratch[j - 1] + 1;
+
+                scratch[j] = d;
+                if (d < best) best = d;
+
+            }
+
+            rows[top] = scratch;
+            scratch = old;
+
+            // Every cell of the band exceeds the budget: nothing below can come back under it
+            if (best > k) alive = false;
+
+        }
+
+        // If the node's key was passed through entirely (i.e. it is not a leaf), its children come next
+
+        if (alive && t->link && !stop) {
+            stack[top].node = t->link;
+            stack[top].depth = depth;
+            stack[top].mismatches = mismatches;
+            top++;
+        }
+
+    }
+
+    for (int i = 0; i < capacity; i++) free(rows[i]);
+    free(rows);
+    free(scratch);
+    free(stack);
+    free(path);
+
+    return found;
+
+}
+
+void RadixTree::adjustCounts(const char* x, int n, int delta) {
+
+    // Same walk as "find", touching every node that "x" passes through completely without ending in it
+
+    Node* t = root;
+
+    while (t) {
+
+        int k = prefix(x, n, t->key(), t->len);
+
+        if (k == 0) { t = t->next; continue; }
+        if (k == n || k != t->len) return;
+
+        t->count += delta;
+
+        x += k;
+        n -= k;
+        t = t->link;
+
+    }
+
+}
+
+RadixTree::Node* RadixTree::sortRadixTreeAux(Node* head) {
+
+    // A rather long example summarizing the steps and code below can be found at the end of this file
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Step 0: A head must have at least one sibling; otherwise...
+    //         If it were an invalid pointer altogether, return it directly
+    //         If it has no siblings, recursively iterate over its children, then return it
+    //         Additionally, prepare all the node pointers that will be used throughout this function
+    // ---------------------------------------------------------------------------------------------------------------
+
+    if (!head) return head;
+    else if (!head->next) { if (head->link) head->link = sortRadixTreeAux(head->link); return head; }
+
+    Node* mid = head, * last = head, * t2 = 0, * t1 = 0, * newHead = 0, * temp = 0;
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Step 1: Splitting into sub-lists recursively
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Initial call sets "head" as root node, and "mid" & "last" always need to point at it initially
+    // The pointer "mid" will be used to traverse all nodes till it reaches the sibling at the middle
+    // The pointer "last" will be used to traverse all nodes till it reaches the (pre-)last sibling
+    // Traverse all siblings of the current level until "mid" & "last" point to their targets
+    while (last->next && last->next->next) { mid = mid->next; last = last->next->next; }
+
+    // Recursively split the sub-list that starts with the sibling to the node at the middle (i.e. the second half)
+    t2 = sortRadixTreeAux(mid->next);
+
+    // Nullify the sibling pointer of the middle node (i.e. unlink these siblings)
+    mid->next = NULL;
+
+    // Recursively merge the sub-list that starts with the head node (i.e. the first half)
+    t1 = sortRadixTreeAux(head);
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Step 2: New Head Determination
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // It is now time to find the new head of this sub-list
+    // At the top of the stack each sub-list will be just one node
+    // We compare them to see who will be the sibling to become the new head
+    // Recursively, this leads to generating sorted sub-lists that undergo the same operation
+
+    // First, we check for the possible scenario that one of the sub-lists is actually empty (head = 0)
+    if (!t1) return t2; if (!t2) return t1; // In that case, the new head will be the other sub-list's directly
+
+    // Now is time to use the "newHead" pointer in the task of determination of the new head of the merged sub-list
+    // Loop over the keys of the two nodes as long as neither of them ends while characters are equal (indicated by...
+    // ..."newhead" pointing at a null value), where once characters differ "newHead" points to either "t1" or "t2"...
+    // ...and otherwise it stays null... It is crucial to remember that "t1" and "t2" are ***sibling nodes***
+    //
+    for (int i = 0; i < t1->len && i < t2->len && !newHead; i++)
+        newHead = ((unsigned char) t1->key()[i] < (unsigned char) t2->key()[i]) ? t1 : ((unsigned char) t2->key()[i] < (unsigned char) t1->key()[i]) ? t2 : 0;
+
+    // When loop breaks, "newHead" is guaranteed to point to the correct node, in doubt? Here are the possible faults:
+
+    // - "ABC-null" vs. "ABC-null": Invalid case; sibling leaf nodes cannot be equal (means duplicate string exists)
+    // - "ABC" vs. "ABC-null": Invalid case; if "ABC" exists (i.e. there's "ABC | something"), it will be a prefix
+    // - "ABC" vs. "AB-null": Invalid case; sibling nodes have "AB" in common, it will be a prefix to "C" & "null"
+    // - "ABC" vs. "ABCD": Invalid case; if "ABC" exists, "ABCD" cannot, as it would be split into "ABC" | "D"
+    // - "ABC" vs. "ABC": Invalid case; duplicate sibling nodes cannot exist in the Radix Tree
+
+    // At this point we increment either pointer "t1" or "t2" based on what "newHead" points to, so that we proceed...
+    // ...with the sibling of the head and not the head itself in the sorting and merging step of this function
+    //
+    if (newHead == t1) t1 = t1->next; else t2 = t2->next;
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Step 3: Merging and Sorting (mergesorting) the sub-lists
+    // ---------------------------------------------------------------------------------------------------------------
+
+    temp = newHead; // Node pointer to be used in merging and sorting the sub-tree's nodes, if they do exist
+    // The same logic used above is used here again to determine which node is smaller out of the two nodes
+    // It starts with the "newHead" since all it does is keep setting the sibling of every node
+
+    // Keep merging (sorting) for as long as both nodes exist
+    while (t1 && t2) {
+
+        for (int i = 0; i < t1->len && i < t2->len; i++) {
+
+            // If "t1" is smaller than "t2", then the next node in our sorted list should be "t1"
+            // Next, we need "temp" to point at the latest addition to the list, which is "t1"
+            // Finally, we need to increment "t1" so it gets evaluated in the next iteration
+            // The opposite happens in case of "t2" being the smaller node of the two
+            //
+            if ((unsigned char) t1->key()[i] < (unsigned char) t2->key()[i]) { temp->next = t1; temp = t1; t1 = t1->next; break; }
+            if ((unsigned char) t1->key()[i] > (unsigned char) t2->key()[i]) { temp->next = t2; temp = t2; t2 = t2->next; break; }
+
+        }
+    }
+
+    // Now once we're outside the loop, we need to remember a crucial piece of information:
+    // "t1" and "t2" point to *sorted* sub-lists. Hence, if the loop took two sub-lists...
+    // ...of lengths "4", and all nodes after "t1" were smaller than "t2" (i.e. no node...
+    // ...from list starting with "t2" has been added yet), simply assigning the "temp"...
+    // ...to "t2" would add all of these nodes to the list, successfully merging + sorting
+    //
+    temp->next = (t1 ? t1 : t2);
+
+    // With this, we have now merged all sub-lists, with "newHead" pointing at the...
+    // ...resulting merged (and sorted) list, so we return it.
+    return newHead;
+
+}
+
+void RadixTree::printNodesAux(ExportBuffer& out) {
+
+    // Each entry of the stack is a node still to be printed along with the length of its prefix, which is always what...
+    // ..."prefix" holds up to that length at the time the node gets popped: a node's siblings are pushed before its...
+    // ...children, so the whole sub-tree beneath it is printed (and done with "prefix") before its next sibling
+
+    int capacity = 64, top = 0, size = 256, number = 0;
+    Node** stack = (Node**) malloc(capacity * sizeof(Node*));
+    int* lengths = (int*) malloc(capacity * sizeof(int));
+    char* prefix = (char*) malloc(size);
+
+    if (root) { stack[0] = root; lengths[0] = 0; top = 1; }
+
+    while (top) {
+
+        top--;
+        Node* t = stack[top];
+        int pLen = lengths[top];
+
+        out.write("Node #");
+        out.writeNumber(number++);
+        out.write(" - ");
+
+        // The prefix, if the node has one, followed by a separator
+
+        if (pLen) {
+            out.write(prefix, pLen);
+            out.write(" | ");
+        }
+
+        // Then the key, or (NULL) if it is only a null character (i.e. the end of a string); otherwise the key is...
+        // ...written as it is, null character included if it has one
+
+        if (t->key()[0] == 0) out.write("(NULL)\n");
+        else { out.write(t->key(), t->len); out.put('\n'); }
+
+        if (top + 2 > capacity) {
+            capacity *= 2;
+            stack = (Node**) realloc(stack, capacity * sizeof(Node*));
+            lengths = (int*) realloc(lengths, capacity * sizeof(int));
+        }
+
+        if (t->next) { stack[top] = t->next; lengths[top] = pLen; top++; }
+
+        if (t->link) {
+
+            // The children's prefix is this node's prefix followed by its own key
+
+            if (pLen + t->len > size) {
+                size = 2 * (pLen + t->len);
+                prefix = (char*) realloc(prefix, size);
+            }
+
+            memcpy(prefix + pLen, t->key(), t->len);
+
+            stack[top] = t->link;
+            lengths[top] = pLen + t->len;
+            top++;
+
+        }
+
+    }
+
+    free(stack);
+    free(lengths);
+    free(prefix);
+
+}
+
+void RadixTree::printTreeAux(ExportBuffer& out) {
+
+    // "branches" holds the branches drawn before the nodes of every level: those of level "d" are its first...
+    // ..."ends[d]" bytes. A node of level "d" extends them for its children with "│   " if it still has siblings to come...
+    // ...(the line going on down to them) or with four spaces if it is the last one; since siblings are only popped...
+    // ...once the whole sub-tree of the previous one is printed, overwriting what lies past "ends[d]" is always safe
+    //
+    // Example of the final output:
+    //
+    // ...
+    // │   ├───T
+    // │   │   ├───CTT
+    // │   │   └───GA
+    // │   └───G
+    // ...
+
+    static const char BAR[] = "│   ", SPACE[] = "    ", TEE[] = "├───", CORNER[] = "└───";
+
+    int capacity = 64, top = 0, levels = 16, size = 256;
+    Node** stack = (Node**) malloc(capacity * sizeof(Node*));
+    int* depths = (int*) malloc(capacity * sizeof(int));
+    int* ends = (int*) malloc(levels * sizeof(int));
+    char* branches = (char*) malloc(size);
+
+    ends[0] = 0;
+    if (root) { stack[0] = root; depths[0] = 0; top = 1; }
+
+    while (top) {
+
+        top--;
+        Node* t = stack[top];
+        int d = depths[top];
+
+        // The branches of the level, then whether the node has siblings still to come ("├───") or not ("└───")
+
+        out.write(branches, ends[d]);
+        out.write(t->next ? TEE : CORNER);
+
+        // Then the key, or (NULL) if it is only a null character, to prevent empty tree branches
+        // Otherwise the key is written as it is, null character included if it has one, since not all keys have one
+
+        if (t->key()[0] == 0) out.write("(NULL)\n");
+        else { out.write(t->key(), t->len); out.put('\n'); }
+
+        if (top + 2 > capacity) {
+            capacity *= 2;
+            stack = (Node**) realloc(stack, capacity * sizeof(Node*));
+            depths = (int*) realloc(depths, capacity * sizeof(int));
+        }
+
+        if (t->next) { stack[top] = t->next; depths[top] = d; top++; }
+
+        if (t->link) {
+
+            const char* branch = t->next ? BAR : SPACE;
+            int n = (int) strlen(branch);
+
+            if (d + 2 > levels) {
+                levels *= 2;
+                ends = (int*) realloc(ends, levels * sizeof(int));
+            }
+
+            if (ends[d] + n > size) {
+                size = 2 * (ends[d] + n);
+                branches = (char*) realloc(branches, size);
+            }
+
+            memcpy(branches + ends[d], branch, n);
+            ends[d + 1] = ends[d] + n;
+
+            stack[top] = t->link;
+            depths[top] = d + 1;
+            top++;
+
+        }
+
+    }
+
+    free(stack);
+    free(depths);
+    free(ends);
+    free(branches);
+
+}
+
+// Clearing function, de-allocates every node and leaves the tree empty
+void RadixTree::clear() {
+
+    // Nodes still waiting for readers to finish are freed first, since they may live in the slabs about to be released
+
+    if (epochs) epochs->drain();
+
+    if (arena) arena->release(); else destroyAux(root);
+    root = 0;
+    stringCount = nodeCount = 0;
+
+    if (bloom) rebuildBloomFilter();
+
+}
+
+// Bulk addition function, builds the whole tree in one pass if it is empty, otherwise adds the strings one by one
+void RadixTree::addStrings(const char* const* begin, const char* const* end, bool sorted) {
+
+    if (root) {
+        for (const char* const* str = begin; str != end; str++) addString(*str);
+        return;
+    }
+
+    // Work on our own array of pointers, so that sorting and dropping duplicates does not touch the caller's array
+
+    int m = (int) (end - begin);
+    const char** s = new const char*[m];
+    for (int i = 0; i < m; i++) s[i] = begin[i];
+
+    if (!sorted) std::sort(s, s + m, [](const char* a, const char* b) { return strcmp(a, b) < 0; });
+
+    int unique = 0;
+    for (int i = 0; i < m; i++) if (!unique || strcmp(s[unique - 1], s[i])) s[unique++] = s[i];
+
+    // Every internal node is pushed onto the stack exactly once, and there are fewer internal nodes than strings
+
+    BuildFrame* stack = new BuildFrame[unique];
+    int top = 0;
+
+    // The root level is built first, then every pending internal node gets its children built, deepest first
+    // The tree is only published once it is complete, so concurrent readers never see it half-built
+
+    Node* head = buildLevel(s, 0, unique, 0, stack, top);
+
+    while (top) {
+        BuildFrame f = stack[--top];
+        f.node->link = buildLevel(s, f.lo, f.hi, f.depth, stack, top);
+    }
+
+    // The strings go into the Bloom filter before the tree is published, so that readers never see a string the...
+    // ...filter would turn away
+
+    if (bloom) {
+        for (int i = 0; i < unique; i++) bloom->add(s[i], (int) strlen(s[i]));
+        bloom->entries += unique;
+    }
+
+    publish(root, head);
+    stringCount = unique;
+
+    if (bloom) checkBloomFilter();
+
+    delete[] stack;
+    delete[] s;
+
+}
+
+// Parallel bulk addition function, builds per-k-mer sub-trees on several threads then stitches them together
+void RadixTree::addStringsParallel(const char* const* begin, const char* const* end, int threads, int k) {
+
+    if (root) {
+        for (const char* const* str = begin; str != end; str++) addString(*str);
+        return;
+    }
+
+    if (threads <= 0) threads = (int) thread::hardware_concurrency();
+    if (threads <= 0) threads = 1;
+
+    // At least one base is needed so that every bucket's sub-tree hangs from a single node, and more than 10 bases...
+    // ...would only mean millions of mostly empty buckets
+    if (k < 1) k = 1;
+    if (k > 10) k = 10;
+
+    // Bucket "b" holds the strings whose first "k" bases, read as a base-4 number (A = 0, C = 1, G = 2, T = 3),...
+    // ...equal "b". Numbering them this way puts the buckets in alphabetical order. Anything else is left aside
+
+    int m = (int) (end - begin), buckets = 1 << (2 * k);
+    int* bucketOf = new int[m];
+    int* first = new int[buckets + 1];
+    for (int b = 0; b <= buckets; b++) first[b] = 0;
+
+    for (int i = 0; i < m; i++) {
+
+        int b = 0, j = 0;
+
+        for (; j < k; j++) {
+            int c = begin[i][j] == 'A' ? 0 : begin[i][j] == 'C' ? 1 : begin[i][j] == 'G' ? 2 : begin[i][j] == 'T' ? 3 : -1;
+            if (c < 0) break;
+            b = 4 * b + c;
+        }
+
+        // The character right after the k-mer must exist too, otherwise the string would end inside the bucket's...
+        // ...shared prefix and could not be stitched as part of a single sub-tree
+        bucketOf[i] = (j == k && begin[i][k]) ? b : -1;
+        if (bucketOf[i] >= 0) first[b + 1]++;
+
+    }
+
+    // Lay the buckets out one after another in a single array ("first[b]" being where bucket "b" starts)
+
+    for (int b = 0; b < buckets; b++) first[b + 1] += first[b];
+
+    const char** sorted = new const char*[first[buckets]];
+    int* fill = new int[buckets];
+    for (int b = 0; b < buckets; b++) fill[b] = first[b];
+    for (int i = 0; i < m; i++) if (bucketOf[i] >= 0) sorted[fill[bucketOf[i]]++] = begin[i];
+
+    // Every thread builds whole buckets in a tree of its own (with an arena of its own, if we have one), detaching...
+    // ...each finished bucket's sub-tree so that the next bucket starts from an empty tree again
+
+    Node** subs = new Node*[buckets];
+    int* subNodes = new int[buckets];
+    RadixTree** workers = new RadixTree*[threads];
+    atomic<int> nextBucket(0);
+
+    thread* pool = new thread[threads];
+
+    for (int w = 0; w < threads; w++) {
 
-RadixTree::Node* RadixTree::find(Node* t, char* x, int n) {
+        workers[w] = new RadixTree(arena != 0);
 
-    // if n is uninitialized, its value is set as the size of "x" (INCLUDING null character, i.e. size of "abc" is 4)
-    // this is consistent with the expected value of the "len" member of each node: number of character, null included
+        pool[w] = thread([&, w]() {
 
-    if (!n) while (x[n++]);
+            RadixTree* tree = workers[w];
 
-    // if provided tree node "t" is null, then there is nothing to be found, we have reached the end of this branch
+            for (int b; (b = nextBucket++) < buckets;) {
 
-    if (!t) return 0;
+                for (int i = first[b]; i < first[b + 1]; i++) tree->addString(sorted[i]);
 
-    // otherwise, if node has value, find the common prefix between it and the key being searched for, "x"
-    // the prefix function is provided the size of both character arrays INCLUDING the null character
+                subs[b] = tree->root;
+                subNodes[b] = tree->nodeCount;
+                tree->root = 0;
+                tree->stringCount = tree->nodeCount = 0;
 
-    int k = prefix(x, n, t->key, t->len);
+            }
 
-    // if there's nothing in common, repeat the process for the next node in this tree level
+        });
 
-    if (k == 0) return find(t->next, x, n);
+    }
 
-    // if all of "x" is prefix, this means the current node IS "x" itself, so return it
+    for (int w = 0; w < threads; w++) pool[w].join();
 
-    if (k == n) return t;
+    // The nodes of every sub-tree now become ours, along with the slabs they live in
 
-    // if the entirety of the current node is a prefix itself...
-    // this means that the string we're looking for could span more than one node...
-    // therefore, continue searching for the remaining part of the searched-for value... how?
-    // go to the node that links this tree level to the next level, a.k.a. t->link, and inside it...
-    // "x + k" makes us skip ahead the prefix found and search for the rest of the string, meanwhile...
-    // "n - k" is the size of the rest of the string.
+    for (int w = 0; w < threads; w++) {
+        if (arena) arena->absorb(*workers[w]->arena);
+        counters += workers[w]->counters;
+        delete workers[w];
+    }
 
-    if (k == t->len) return find(t->link, x + k, n - k);
+    // Stitch the sub-trees in alphabetical order (after adding their strings to the Bloom filter, for the same...
+    // ...reason as in "addStrings"), then add whatever did not fall into a bucket
 
-    return 0;
+    if (bloom) for (int i = 0; i < first[buckets]; i++) bloom->add(sorted[i], (int) strlen(sorted[i]));
 
-}
+    for (int b = 0; b < buckets; b++) if (subs[b]) graft(subs[b], subNodes[b]);
 
-void RadixTree::split(Node* t, int k) {
+    if (bloom) {
+        bloom->entries = stringCount + bloom->stale;
+        checkBloomFilter();
+    }
 
-    // Let's use the following example to explain this function:
+    for (int i = 0; i < m; i++) if (bucketOf[i] < 0) addString(begin[i]);
 
-    // Split the following node at position 4:  [parent ---- "ABCDEF null" ---- child]
-    // Required Result:                         [parent ---- "ABCD" ---- "EF null" ---- child]
+    delete[] pool;
+    delete[] workers;
+    delete[] subNodes;
+    delete[] subs;
+    delete[] fill;
+    delete[] sorted;
+    delete[] first;
+    delete[] bucketOf;
 
-    // Create a node that carries everything after the first "k" characters in the current node
+}
 
-    Node* p = new Node(t->key + k, t->len - k); // In our example, this means: p = "EF null"
+// Concurrent-read mode activation function, from now on unlinked nodes are retired through the epoch manager
+void RadixTree::enableConcurrentReads() {
+    if (!epochs) epochs = new EpochManager(&RadixTree::reclaimNode, this);
+}
 
-    // Set this newly created node's link/child node as the current one's (maintaining sequentiality)
+// Bloom filter functions, the filter is built from the strings already in the tree
+void RadixTree::enableBloomFilter(int bitsPerString) {
+    delete bloom;
+    bloom = new BloomFilter(1024, bitsPerString);
+    rebuildBloomFilter();
+}
 
-    p->link = t->link; // In our example, this means: p = "EF null" ---- child
+void RadixTree::disableBloomFilter() {
+    delete bloom;
+    bloom = 0;
+}
 
-    // Set the current node's link/child as the newly created node
+void RadixTree::rebuildBloomFilter() {
 
-    t->link = p; // In our example, this means: t = "ABCDEF null" ---- "EF null" ---- child
+    long long capacity = 2LL * stringCount;
+    BloomFilter* filter = new BloomFilter(capacity < 1024 ? 1024 : capacity, bloom->bits());
 
-    // Now take the first "k" characters and place them in a temporary character array
+    for (iterator it = begin(); it != end(); ++it) filter->add(*it, it.length());
+    filter->entries = stringCount;
 
-    char* a = new char[k];
-    for (int i = 0; i < k; i++) a[i] = t->key[i];
+    delete bloom;
+    bloom = filter;
 
-    // Delete the current key and replace it with the temporary character array just created, with its size
+}
 
-    delete[] t->key;
-    t->key = a;
-    t->len = k;
+void RadixTree::checkBloomFilter() {
+    if (!epochs && (bloom->entries > bloom->capacity || bloom->stale > stringCount)) rebuildBloomFilter();
+}
 
-    // In our example, this means: t = "ABCD" ---- "EF null" ---- child
-    // Successfully splitting the node at position 4.
+// Addition function, measures the string once then adds it
+void RadixTree::addString(const char* str) {
+    int n = 0;
+    while (str[n]) n++;
+    addString(str, n);
+}
 
+// Deletion function, measures the string once then deletes it
+void RadixTree::deleteString(const char* str) {
+    int n = 0;
+    while (str[n]) n++;
+    deleteString(str, n);
 }
 
-RadixTree::Node* RadixTree::insert(Node* t, char* x, int n) {
+// Searching function, returns boolean value based on the result of the finder function
+bool RadixTree::searchString(const char* str) {
+    int n = 0;
+    while (str[n]) n++;
+    return searchString(str, n);
+}
 
-    // if n is uninitialized, its value is set as the size of "x" (INCLUDING null character, i.e. size of "abc" is 4)
-    // this is consistent with the expected value of the "len" member of each node: number of character, null included
+// Explicit-length versions of the three functions above
+void RadixTree::addString(const char* str, int len) {
 
-    if (!n) while (x[n++]);
+    // The string goes into the Bloom filter before the tree, so that readers never see a string the filter would...
+    // ...turn away (adding a string that is already there changes nothing)
 
-    // if current tree node "t" is null, this means we've reached our insertion point, hence create and return the node
-    // notice that this function is used either within another function (like addString) or recursively within itself...
-    // i.e. the returned node goes to the root of the tree or somewhere else in it, depending on the parent function
+    if (!bloom) { insert(str, len + 1); return; }
 
-    if (!t) return new Node(x, n);
+    bloom->add(str, len);
+    if (insert(str, len + 1)) { bloom->entries++; checkBloomFilter(); }
 
-    // otherwise, if node has value, find the common prefix between it and the key to be inserted, "x"
-    // the prefix function is provided the size of both character arrays INCLUDING the null character
+}
 
-    int k = prefix(x, n, t->key, t->len);
+void RadixTree::deleteString(const char* str, int len) {
 
-    // if there's nothing in common, attempt to insert the node to be inserted in the "next" node of the current node
+    // A deleted string cannot be taken out of the Bloom filter, it only makes it a little staler
 
-    if (k == 0) t->next = insert(t->next, x, n);
+    if (remove(str, len + 1) && bloom) { bloom->stale++; checkBloomFilter(); }
 
-    // otherwise, if part of the current node is a prefix of the key to be added...
-    // observe the following examples of current nodes for key ABCF-null:
-    // 1. current node: ABCDE-null,    ... k < n (3 < 5)
-    // 2. current node: ABC-null,      ... k < n (3 < 5)
-    // 3. current node: ABCF,          ... k < n (4 < 5)
-    // 4. current node: ABCF-null,     ... k = n (5 = 5) (not in this else if branch)
+}
 
-    else if (k < n)
-    {
-        // if the node is larger, split it
-        // -- this applies to example 1, where "ABCDE-null" would be split into "ABC|DE-null".
-        // -- this also applies to example 2, where "ABC-null" would actually be split into "ABC|null"
-        // -- however in case of example 3, the current node size is actually equal to the prefix, so no split
+bool RadixTree::searchString(const char* str, int len) {
 
-        if (k < t->len) split(t, k);
+    if (bloom && !bloom->mayContain(str, len)) { RADIXTREE_COUNT(filterRejects, 1); return false; }
 
-        // at this point, we insert what remains after the prefix (aka the "F")
+    // In concurrent-read mode the search registers itself with the epoch manager for as long as it walks the tree
 
-        t->link = insert(t->link, x + k, n - k);
+    bool found;
 
-        // for example 1, this gives us "ABC-DE-null" and "ABC-F-null" as two new children, but no "ABC-null"
-        // for example 2, this gives us "ABC-null" and "ABC-F-null" as the two children.
-        // for example 3, we only get "ABCF-null"
+    if (!epochs) found = find(str, len + 1) != 0;
+    else {
+        EpochManager::ReadGuard guard(*epochs);
+        found = find(str, len + 1) != 0;
     }
 
-    // otherwise, the node to be added is the current node itself (k != 0 and >= n), so just return it! (example 4)
-    return t;
+    if (bloom && !found) RADIXTREE_COUNT(filterFalsePositives, 1);
+    return found;
 
 }
 
-void RadixTree::join(Node* t) {
+// Batched finder function, every search in flight moves on by one node per turn
+void RadixTree::findMany(const char* const* queries, int n, bool* results) {
 
-    // Let's use the following example to explain this function:
+    // A search in flight: the node it is at, what is left of its query (null terminator included), where its result...
+    // ...goes, and whether the node's key (when not stored in the node) has been asked for already
 
-    // Join the following node (with its link): [parent ---- "ABCD" ---- "EF null" ---- child]
-    // Required Result:                         [parent ---- "ABCDEF null" ---- child]
+    struct Lookup {
+        Node* t;
+        const char* x;
+        int n;
+        int index;
+        bool keyRequested;
+    };
 
-    // Point towards the link node of the current node
+    Lookup group[SEARCH_GROUP];
+    int active = 0, next = 0;
 
-    Node* p = t->link; // In our example, this means: p = "EF null"
+    Node* top = acquire(root);
 
-    // Create a character array to store the current node as well as the link node's characters
+    while (next < n || active) {
 
-    char* a = new char[t->len + p->len];
+        // Fill the free slots with new searches, answering right away those the Bloom filter turns away (or all...
+        // ...of them, if the tree is empty), and prefetching the first node of the others
 
-    // Copy the contents of the current node into the temporary array
+        while (active < SEARCH_GROUP && next < n) {
 
-    for (int i = 0; i < t->len; i++) a[i] = t->key[i]; // a = "ABCD"
+            const char* x = queries[next];
+            int len = (int) strlen(x);
 
-    // Copy the contents of the link node afterwards
+            if (!top || (bloom && !bloom->mayContain(x, len))) {
+                if (top) RADIXTREE_COUNT(filterRejects, 1);
+                results[next++] = false;
+                continue;
+            }
 
-    for (int i = 0; i < p->len; i++) a[t->len + i] = p->key[i]; // a = "ABCDEF null"
+            RADIXTREE_COUNT(lookups, 1);
 
-    // Delete the current key and replace it with the temporary character array just created
+            Lookup& l = group[active++];
+            l.t = top;
+            l.x = x;
+            l.n = len + 1;
+            l.index = next++;
+            l.keyRequested = false;
 
-    delete[] t->key;
-    t->key = a;
+            prefetch(top);
 
-    // Increase its size by the size of the link node
+        }
 
-    t->len += p->len;
+        // One step of every search in flight, in turns. A finished search leaves its slot to the last one, which...
+        // ...then takes its turn right away
 
-    // Set the link of the current node as the link of its own link node (i.e. skipping it)
+        for (int i = 0; i < active;) {
 
-    t->link = p->link; // In our example, this means: t = "ABCDEF null" ---- child
+            Lookup& l = group[i];
+            Node* t = l.t;
 
-    // Finally, delete the now-duplicated node
+            // The node has (most likely) arrived. If its key lives outside of it, ask for the key and come back...
+            // ...next turn rather than wait for it now
 
-    delete p;
+            if (!t->inlineKey() && !l.keyRequested) {
+                prefetch(t->key());
+                l.keyRequested = true;
+                i++;
+                continue;
+            }
 
-}
+            // From here on, exactly the same decisions as "find"
 
-RadixTree::Node* RadixTree::remove(Node* t, char* x, int n) {
+            int k = prefix(l.x, l.n, t->key(), t->len);
+            RADIXTREE_COUNT(nodesVisited, 1);
 
-    // if n is uninitialized, its value is set as the size of "x" (INCLUDING null character, i.e. size of "abc" is 4)
-    // this is consistent with the expected value of the "len" member of each node: number of character, null included
+            int found = -1;
 
-    if (!n) while (x[n++]);
+            if (k == 0) {
+                if ((unsigned char) t->key()[0] > (unsigned char) l.x[0]) found = 0;
+                else {
+                    RADIXTREE_COUNT(siblingHops, 1);
+                    l.t = acquire(t->next);
+                }
+            }
+            else if (k == l.n) found = 1;
+            else if (k != t->len) found = 0;
+            else {
+                l.x += k;
+                l.n -= k;
+                l.t = acquire(t->link);
+            }
 
-    // if provided tree node "t" is null, then there is nothing to be removed
+            if (found < 0 && !l.t) found = 0;
 
-    if (!t) return 0;
+            if (found < 0) {
+                prefetch(l.t);
+                l.keyRequested = false;
+                i++;
+                continue;
+            }
 
-    // otherwise, if node has value, find the common prefix between it and the key being searched for, "x"
-    // the prefix function is provided the size of both character arrays INCLUDING the null character
+            results[l.index] = found == 1;
+            if (bloom && !found) RADIXTREE_COUNT(filterFalsePositives, 1);
 
-    int k = prefix(x, n, t->key, t->len);
+            group[i] = group[--active];
 
-    // if all of "x" is prefix, this means the current node IS "x" itself, so remove it (by replacing it with its next)
+        }
 
-    if (k == n)
-    {
-        Node* p = t->next;
-        delete t;
-        return p;
     }
 
-    // if there's nothing in common, repeat the process for the next node in this tree level
+}
 
-    if (k == 0) t->next = remove(t->next, x, n);
+// Batched searching function, the same walk as "find" cut into steps, with the steps of several searches interleaved
+void RadixTree::searchMany(const char* const* queries, int n, bool* results) {
 
-    // otherwise if the current node is a prefix itself... for example...
-    // key: ABCDE-null
-    // current node: ABC
+    // In concurrent-read mode the batch registers itself with the epoch manager for as long as it walks the tree
 
-    // then: k = 3, t->len = 3, n = 6
+    if (!epochs) { findMany(queries, n, results); return; }
 
-    else if (k == t->len)
-    {
-        // proceed to the link(s) of this node with the rest of the key (in this case, DE-null), attempting to remove again
-        // let's say the link was "DE-null". If we go upwards, we find that this is the (k == n) case, where the link gets...
-        // ...replaced by the link after it (connected to it by "next").
+    EpochManager::ReadGuard guard(*epochs);
+    findMany(queries, n, results);
 
-        t->link = remove(t->link, x + k, n - k);
+}
 
-        // accordingly, if "t" ends up with only one link (which we can find by seeing if its link has a next or not)...
-        // ...merge it with that link so as to make it one node.
+// String counting function, returns the total number of string in the current Radix Tree
+int RadixTree::countStrings() {
+    return stringCount;
+}
 
-        if (t->link && !t->link->next) join(t);
-    }
+// Node counting function, returns the total number of nodes in the current Radix Tree
+int RadixTree::countNodes() {
+    return nodeCount;
+}
 
-    // otherwise, the node to be removed was not found, so return this node as it is (i.e. no changes)
+// Statistics functions, the counters are only ever non-zero in "RADIXTREE_STATS" builds
+RadixTree::Stats RadixTree::stats() const {
 
-    return t;
+    Stats s = counters;
+
+#ifdef RADIXTREE_STATS
+    s.enabled = true;
+#endif
+
+    return s;
 
 }
 
-int RadixTree::countStringsAux(Node* t) {
+void RadixTree::resetStats() {
+    counters = Stats();
+}
 
-    if (!t) return 0; // if provided tree node "t" is null, then there is no strings in it
+RadixTree::Stats& RadixTree::Stats::operator+=(const Stats& other) {
+
+    lookups += other.lookups;
+    insertions += other.insertions;
+    removals += other.removals;
+    nodesVisited += other.nodesVisited;
+    siblingHops += other.siblingHops;
+    prefixBytes += other.prefixBytes;
+    splits += other.splits;
+    joins += other.joins;
+    allocations += other.allocations;
+    deallocations += other.deallocations;
+    bytesAllocated += other.bytesAllocated;
+    bytesFreed += other.bytesFreed;
+    filterRejects += other.filterRejects;
+    filterFalsePositives += other.filterFalsePositives;
+
+    return *this;
 
-    return (!t->link) // if it has no children, then it is the end of a string so add 1
-        + countStringsAux(t->next) // then recursively visit all siblings
-        + countStringsAux(t->link) // then recursively visit all children
-        ;
 }
 
-int RadixTree::countNodesAux(Node* t) {
+void RadixTree::Stats::print(ostream& out) const {
+
+    if (!enabled) {
+        out << "Statistics are disabled (compile RadixTree.cpp with RADIXTREE_STATS defined to enable them)" << "\n";
+        return;
+    }
 
-    if (!t) return 0; // if provided tree node "t" is null, then there is no Nodes in it
+    // Averages are taken over every call that walks the tree, whichever of the three it is
+    long long calls = lookups + insertions + removals;
+    double per = calls ? 1.0 / calls : 0.0;
+
+    out << "Lookups:          " << lookups << "\n";
+    out << "Insertions:       " << insertions << "\n";
+    out << "Removals:         " << removals << "\n";
+    out << "Nodes visited:    " << nodesVisited << " (" << nodesVisited * per << " per call)" << "\n";
+    out << "Sibling hops:     " << siblingHops << " (" << siblingHops * per << " per call)" << "\n";
+    out << "Prefix bytes:     " << prefixBytes << " (" << prefixBytes * per << " per call)" << "\n";
+    out << "Splits:           " << splits << "\n";
+    out << "Joins:            " << joins << "\n";
+    out << "Allocations:      " << allocations << " (" << bytesAllocated << " bytes)" << "\n";
+    out << "Deallocations:    " << deallocations << " (" << bytesFreed << " bytes)" << "\n";
+    out << "Filter rejects:   " << filterRejects << "\n";
+    out << "Filter false pos: " << filterFalsePositives << "\n";
 
-    return 1 // Always add 1. Doesn't matter if it's a leaf node or not
-        + countNodesAux(t->next) // then recursively visit all siblings 
-        + countNodesAux(t->link) // then recursively visit all children 
-        ;
 }
 
-RadixTree::Node* RadixTree::sortRadixTreeAux(Node* head) {
+// Number of bytes the heap actually holds for block "p" of "n" bytes, its header and rounding included
+static long long heapBlockBytes(void* p, long long n) {
 
-    // A rather long example summarizing the steps and code below can be found at the end of this file
+#if defined(__GLIBC__)
+    // glibc can tell the usable size of the block, which sits right after a header of one "size_t"
+    (void) n;
+    return (long long) (malloc_usable_size(p) + sizeof(size_t));
+#else
+    // Elsewhere, assume the usual 64-bit malloc: a "size_t" header, blocks rounded up to 16 bytes and 32 bytes at least
+    (void) p;
+    long long b = (n + (long long) sizeof(size_t) + 15) & ~15LL;
+    return b < 32 ? 32 : b;
+#endif
 
-    // ---------------------------------------------------------------------------------------------------------------
-    // Step 0: A head must have at least one sibling; otherwise...
-    //         If it were an invalid pointer altogether, return it directly
-    //         If it has no siblings, recursively iterate over its children, then return it
-    //         Additionally, prepare all the node pointers that will be used throughout this function
-    // ---------------------------------------------------------------------------------------------------------------
+}
 
-    if (!head) return head;
-    else if (!head->next) { if (head->link) head->link = sortRadixTreeAux(head->link); return head; }
+MemoryReport RadixTree::memoryReport() {
 
-    Node* mid = head, * last = head, * t2 = 0, * t1 = 0, * newHead = 0, * temp = 0;
+    MemoryReport report;
+    report.nodes = nodeCount;
+    report.strings = stringCount;
 
-    // ---------------------------------------------------------------------------------------------------------------
-    // Step 1: Splitting into sub-lists recursively
-    // ---------------------------------------------------------------------------------------------------------------
+    // Every sibling list is visited as a whole, so its length (the fanout of its parent) is known on the way
+    // Each entry of the stack is a sibling list still to be visited, along with the level it is at
 
-    // Initial call sets "head" as root node, and "mid" & "last" always need to point at it initially
-    // The pointer "mid" will be used to traverse all nodes till it reaches the sibling at the middle
-    // The pointer "last" will be used to traverse all nodes till it reaches the (pre-)last sibling
-    // Traverse all siblings of the current level until "mid" & "last" point to their targets
-    while (last->next && last->next->next) { mid = mid->next; last = last->next->next; }
+    int capacity = 64, top = 0;
+    Node** lists = (Node**) malloc(capacity * sizeof(Node*));
+    int* levels = (int*) malloc(capacity * sizeof(int));
 
-    // Recursively split the sub-list that starts with the sibling to the node at the middle (i.e. the second half)
-    t2 = sortRadixTreeAux(mid->next);
+    long long heapBytes = 0;
 
-    // Nullify the sibling pointer of the middle node (i.e. unlink these siblings)
-    mid->next = NULL;
+    if (root) { lists[0] = root; levels[0] = 0; top = 1; }
 
-    // Recursively merge the sub-list that starts with the head node (i.e. the first half)
-    t1 = sortRadixTreeAux(head);
+    while (top) {
 
-    // ---------------------------------------------------------------------------------------------------------------
-    // Step 2: New Head Determination
-    // ---------------------------------------------------------------------------------------------------------------
+        top--;
+        Node* t = lists[top];
+        int level = levels[top];
+        int siblings = 0;
 
-    // It is now time to find the new head of this sub-list
-    // At the top of the stack each sub-list will be just one node
-    // We compare them to see who will be the sibling to become the new head
-    // Recursively, this leads to generating sorted sub-lists that undergo the same operation
+        for (; t; t = t->next) {
 
-    // First, we check for the possible scenario that one of the sub-lists is actually empty (head = 0)
-    if (!t1) return t2; if (!t2) return t1; // In that case, the new head will be the other sub-list's directly
+            siblings++;
 
-    // Now is time to use the "newHead" pointer in the task of determination of the new head of the merged sub-list
-    // Loop over the keys of the two nodes as long as neither of them ends while characters are equal (indicated by...
-    // ..."newhead" pointing at a null value), where once characters differ "newHead" points to either "t1" or "t2"...
-    // ...and otherwise it stays null... It is crucial to remember that "t1" and "t2" are ***sibling nodes***
-    //
-    for (int i = 0; i < t1->len && i < t2->len && !newHead; i++)
-        newHead = (t1->key[i] < t2->key[i]) ? t1 : (t2->key[i] < t1->key[i]) ? t2 : 0;
+            report.depth.add(level);
+            report.labelLength.add(t->len);
 
-    // When loop breaks, "newHead" is guaranteed to point to the correct node, in doubt? Here are the possible faults:
+            if (t->inlineKey()) {
+                report.inlineLabelBytes += t->len;
+                report.unusedInlineBytes += Node::INLINE_KEY - t->len;
+            } else {
+                report.labelBytes += t->len;
+                report.unusedInlineBytes += Node::INLINE_KEY - sizeof(char*);
+                if (!arena) heapBytes += heapBlockBytes(t->key(), t->len);
+            }
 
-    // - "ABC-null" vs. "ABC-null": Invalid case; sibling leaf nodes cannot be equal (means duplicate string exists)
-    // - "ABC" vs. "ABC-null": Invalid case; if "ABC" exists (i.e. there's "ABC | something"), it will be a prefix
-    // - "ABC" vs. "AB-null": Invalid case; sibling nodes have "AB" in common, it will be a prefix to "C" & "null"
-    // - "ABC" vs. "ABCD": Invalid case; if "ABC" exists, "ABCD" cannot, as it would be split into "ABC" | "D"
-    // - "ABC" vs. "ABC": Invalid case; duplicate sibling nodes cannot exist in the Radix Tree
+            if (!t->next) report.unusedLinkBytes += sizeof(Node*);
 
-    // At this point we increment either pointer "t1" or "t2" based on what "newHead" points to, so that we proceed...
-    // ...with the sibling of the head and not the head itself in the sorting and merging step of this function
-    //
-    if (newHead == t1) t1 = t1->next; else t2 = t2->next;
+            if (!arena) heapBytes += heapBlockBytes(t, sizeof(Node));
 
-    // ---------------------------------------------------------------------------------------------------------------
-    // Step 3: Merging and Sorting (mergesorting) the sub-lists
-    // ---------------------------------------------------------------------------------------------------------------
+            if (!t->link) {
+                report.terminalDepth.add(level);
+                report.unusedLinkBytes += sizeof(Node*);
+                continue;
+            }
 
-    temp = newHead; // Node pointer to be used in merging and sorting the sub-tree's nodes, if they do exist
-    // The same logic used above is used here again to determine which node is smaller out of the two nodes
-    // It starts with the "newHead" since all it does is keep setting the sibling of every node
+            if (top == capacity) {
+                capacity *= 2;
+                lists = (Node**) realloc(lists, capacity * sizeof(Node*));
+                levels = (int*) realloc(levels, capacity * sizeof(int));
+            }
 
-    // Keep merging (sorting) for as long as both nodes exist
-    while (t1 && t2) {
+            lists[top] = t->link;
+            levels[top] = level + 1;
+            top++;
 
-        for (int i = 0; i < t1->len && i < t2->len; i++) {
+        }
 
-            // If "t1" is smaller than "t2", then the next node in our sorted list should be "t1"
-            // Next, we need "temp" to point at the latest addition to the list, which is "t1"
-            // Finally, we need to increment "t1" so it gets evaluated in the next iteration
-            // The opposite happens in case of "t2" being the smaller node of the two
-            //
-            if (t1->key[i] < t2->key[i]) { temp->next = t1; temp = t1; t1 = t1->next; break; }
-            if (t1->key[i] > t2->key[i]) { temp->next = t2; temp = t2; t2 = t2->next; break; }
+        report.fanout.add(siblings);
 
-        }
     }
 
-    // Now once we're outside the loop, we need to remember a crucial piece of information:
-    // "t1" and "t2" point to *sorted* sub-lists. Hence, if the loop took two sub-lists...
-    // ...of lengths "4", and all nodes after "t1" were smaller than "t2" (i.e. no node...
-    // ...from list starting with "t2" has been added yet), simply assigning the "temp"...
-    // ...to "t2" would add all of these nodes to the list, successfully merging + sorting
-    //
-    temp->next = (t1 ? t1 : t2);
+    free(lists);
+    free(levels);
 
-    // With this, we have now merged all sub-lists, with "newHead" pointing at the...
-    // ...resulting merged (and sorted) list, so we return it.
-    return newHead;
+    report.nodeBytes = (long long) nodeCount * sizeof(Node);
 
-}
+    // An arena knows exactly how much it took from the system, everything not taken by nodes and keys is overhead
 
-char** RadixTree::fetchStringsAux(Node* t, bool echo, bool sort) {
+    if (arena) report.allocatorBytes = (long long) arena->bytesReserved() - report.nodeBytes - report.labelBytes;
+    else report.allocatorBytes = heapBytes - report.nodeBytes - report.labelBytes;
 
-    // First, we prepare a pointer that would point to a clone of the current Radix Tree to sort it if required before fetching strings
-    static RadixTree* clone;
+    report.filterBytes = bloom ? bloom->bytes() : 0;
 
-    static int offset, stringNum, numOfStrings; // Offset in string's prefix, string's number, and number of strings
-    static char** strings; // Array (P2P) to store all of the strings that get fetched from the current Radix Tree
-    static char* prefix; // Dynamically allocated prefix for sibling nodes, doesn't need explicit initialization
+    return report;
 
-    // If start of first call to function (indicated by "t" pointing at the root node), begin initialization
-    // There is a special case here where the root node of the original tree may reappear later on in the...
-    // ...sorted tree, hence we need an extra check and that is the clone value, where if it is null then...
-    // ...it hasn't been created yet (i.e. we didn't enter this function before), but afterwards it'll exist
-    if (t == root && !clone) {
+}
 
-        if (sort) { // If sorting is required
+// Rank function, returns the number of strings that come before "str" alphabetically
+int RadixTree::rank(const char* str) {
 
-            clone = new RadixTree(this); // Create a clone of the current tree
+    int n = 0;
+    while (str[n++]);
 
-            // Then sort its nodes via merge sort (modifies the tree; hence the cloning)...
-            // ...and then, set "t" to point at the clone tree's root instead of this one's
-            clone->sortRadixTree();
-            t = clone->root;
+    // At every level, every sibling that comes before the remaining part of "str" contributes its whole sub-tree
+    // Sibling nodes always differ in their first character (and are kept in that order), so comparing first...
+    // ...characters is enough to order them, except for the one sibling that shares a prefix with "str", which we...
+    // ...either descend into or compare further
 
-        } // Otherwise, it is already initialized as the root from the original call
+    int r = 0, k = 0;
+    Node* t = root;
 
-        offset = stringNum = 0;
-        numOfStrings = countStrings();
-        strings = (char**) calloc(numOfStrings, sizeof(char*));
+    while (t) {
 
-    }
+        Node* match = 0;
 
-    // For prefixes, dynamically resize such that it contains:
-    // 1. Itself (length determined by its current offset value)
-    // 2. Node "t"'s key (length determined by node variable "len")
-    // For leaf nodes, "len" takes into consideration the null terminator, so we don't need to explicitly add "1"
-    prefix = (char*) realloc(prefix, sizeof(char) * (offset + t->len));
+        for (; t && (unsigned char) t->key()[0] <= (unsigned char) str[0]; t = t->next) {
 
-    // For all characters of the node's key, including NULL character if exists, copy into current string, incrementing the offset simultaneously
-    for (int i = 0; i < t->len; i++) prefix[offset++] = t->key[i];
+            if ((unsigned char) t->key()[0] < (unsigned char) str[0]) r += t->count;
+            else { match = t; k = prefix(str, n, t->key(), t->len); }
 
-    if (t->link) fetchStringsAux(t->link, echo, sort); // If a child exists, traverse to it, which recursively means traverse until the leaf node
+        }
+
+        // No sibling shares anything with "str", or "str" is in the tree: done either way
+        if (!match || k == n) break;
 
-    // If we reach a leaf (i.e end of a string) the prefix would have a null terminator (copied from it), which is our signal to finally store it
-    if (prefix[offset - 1] == 0) {
+        // The node splits away from "str" somewhere in the middle of its key, so all of it comes before or after "str"
+        if (k < match->len) {
+            if ((unsigned char) match->key()[k] < (unsigned char) str[k]) r += match->count;
+            break;
+        }
 
-        // Re-allocate the current string's size and fill it with what's been added to the prefix thus far
-        strings[stringNum] = (char*) realloc(strings[stringNum], offset * sizeof(char));
-        for (int i = 0; i < offset; i++) strings[stringNum][i] = prefix[i];
+        // The entire node is a prefix of "str", so carry on with the rest of "str" among its children
+        str += k;
+        n -= k;
+        t = match->link;
 
     }
 
-    // At this point in the code, we've finished processing the first recursive call
-    // This means its time to visit a sibling node (or - if none exist - terminate this function and proceed to parent function - if exists)
-    // In all cases, this calls for shrinking the prefix via removing the current node's key from it - done by simply changing the offset value
-    offset -= t->len;
+    return r;
+
+}
+
+// Select function, returns the string at position "i" in alphabetical order
+char* RadixTree::select(int i) {
+
+    if (i < 0 || i >= stringCount) return 0;
+
+    char* str = 0;
+    int len = 0;
+    Node* t = root;
 
-    // If a sibling exists, traverse to it, which recursively means traverse over all sibling nodes, which also implies we're having a new string
-    if (t->next) { stringNum++; fetchStringsAux(t->next, echo, sort); }
+    // At every level, visit the siblings (in alphabetical order), skipping whole sub-trees while "i" is beyond them,...
+    // ...until reaching the sibling whose sub-tree contains the i-th string
 
-    // If end of first call to function (indicated by the the current node now being the clone's root node - if we're sorting - or the root node)
-    if (t == (sort ? clone->root : root)) {
+    while (t) {
 
-        // Print all of the generated and stored strings if required
-        if (echo) for (int i = 0; i < numOfStrings; i++) cout << i << ". " << strings[i] << endl;
+        Node* chosen = t;
 
-        // De-allocate memory occupied by the clone tree and the prefix, then reset it to being a null pointer for potential future re-usage
-        if (sort) delete clone; clone = 0;
-        free(prefix); prefix = 0;
+        while (i >= chosen->count) {
+            i -= chosen->count;
+            chosen = chosen->next;
+        }
+
+        // Append the chosen node's key to the string being built, then go down a level (leaves end the string)
+        str = (char*) realloc(str, len + chosen->len);
+        for (int j = 0; j < chosen->len; j++) str[len++] = chosen->key()[j];
 
-        // Finally, return the array of strings (expecting whoever uses it to de-allocate it themselves afterwards)
-        return strings;
+        t = chosen->link;
 
     }
 
-    // If not the first call, and there's no child or sibling, then terminate this function and return nothin; nobody is awaiting its return value
-    return 0;
+    return str;
+
 }
 
-void RadixTree::heapifyNodes(Node** arr, int n, int i) {
+// Sampling function, returns a uniformly random string from the tree
+char* RadixTree::sample() {
 
-    int largest = i; // Initialize largest as root
-    int l = 2 * i + 1; // left = 2*i + 1
-    int r = 2 * i + 2; // right = 2*i + 2
+    if (!stringCount) return 0;
 
-    // If left child is larger than root
-    if (l < n && arr[l]->key[0] > arr[largest]->key[0])
-        largest = l;
+    // A single "rand" may only reach 32767, so two of them are combined to cover large trees as well
+    long long r = (long long) rand() * ((long long) RAND_MAX + 1) + rand();
 
-    // If right child is larger than largest so far
-    if (r < n && arr[r]->key[0] > arr[largest]->key[0])
-        largest = r;
+    return select((int) (r % stringCount));
 
-    // If largest is not root
-    if (largest != i) {
+}
 
-        swap(arr[i], arr[largest]);
+// Prefix counting function, the node where the prefix ends already knows how many strings are beneath it
+int RadixTree::countWithPrefix(const char* prefix) {
 
-        // Recursively heapify the affected sub-tree
-        heapifyNodes(arr, n, largest);
+    int m = (int) strlen(prefix), offset;
+    if (!m) return stringCount;
+
+    Node* t = findPrefix(prefix, m, offset);
+    return t ? t->count : 0;
 
-    }
 }
 
-void RadixTree::heapSortNodes(Node** arr, int size) {
+// Prefix scanning function, iterates over the sub-tree of the node where the prefix ends, and nothing else
+int RadixTree::forEachWithPrefix(const char* prefix, Visitor visit, void* context) {
 
-    // Build heap (rearrange array)
-    for (int i = size / 2 - 1; i >= 0; i--)
-        heapifyNodes(arr, size, i);
+    int m = (int) strlen(prefix), offset, visited = 0;
 
-    // One by one extract an element from heap
-    for (int i = size - 1; i > 0; i--) {
+    Node* t = findPrefix(prefix, m, offset);
+    if (!t) return 0;
 
-        // Move current root to end
-        Node* temp = arr[i];
-        arr[i] = arr[0];
-        arr[0] = temp;
+    // With an empty prefix "t" is the root, whose siblings are part of the scan too
 
-        // call max heapify on the reduced heap
-        heapifyNodes(arr, i, 0);
+    iterator it;
+    it.start(t, prefix, offset, m > 0);
 
+    for (; it != end(); ++it) {
+        visited++;
+        if (!visit(*it, it.length(), context)) break;
     }
+
+    return visited;
+
+}
+
+// Hamming distance search function, everything is done by the approximate search function
+int RadixTree::searchHamming(const char* query, int k, Visitor visit, void* context) {
+    return approximateSearch(query, k, false, visit, context);
 }
 
-void RadixTree::sortAndPrintStringsAux(Node* t, bool echo, char* p, int pLen) {
+// Edit distance search function, same as above
+int RadixTree::searchEdit(const char* query, int k, Visitor visit, void* context) {
+    return approximateSearch(query, k, true, visit, context);
+}
 
-    if (!t) return; // if provided tree node "t" is null, then there is nothing to do.
+// Snapshot building function, lays the nodes out breadth-first so that the children of every node are contiguous
+char* RadixTree::buildSnapshot(size_t& size) {
 
-    int itr = 0;  // iterator to loop over all siblings of the current node.
+    // "order[i]" is the node stored as record "i", record 0 being the virtual root (hence the NULL)
+    // The extra record at the end is the sentinel, which only marks where the label pool ends
 
-    // Array of nodes to hold all nodes in the current level.
-    // Size equal the number of characters in ASCII table.
-    Node** arr = new Node * [128];
-    Node* temp = t;
+    int total = nodeCount + 1, tail = 1;
+    Node** order = (Node**) malloc(total * sizeof(Node*));
+    size_t labelBytes = 0;
 
-    // Store all siblings in the array.
-    while (temp != 0)
-    {
-        arr[itr] = temp;
-        temp = temp->next;
-        itr++;
-    }
+    order[0] = 0;
 
-    // Sort using heap sort algorithm.
-    heapSortNodes(arr, itr);
-    Node* n;
+    // First pass: the order, which the size of the label pool (and thus of the block) depends on
 
-    // Looping over the sorted array of nodes.
-    for (int i = 0; i < itr; i++)
-    {
-        n = arr[i];
+    for (int head = 0; head < tail; head++) {
 
-        // If the node has no children, print it.
-        if (!n->link) {
+        Node* t = order[head];
+        if (t) labelBytes += t->len;
 
-            // Printing the prefix of the node.
-            for (int i = 0; i < pLen; i++) { if (segmentsFile) segmentsFile << p[i]; if (echo) cout << p[i]; }
+        // Sibling lists are already in alphabetical order, which is what lets the snapshot binary search them
+        for (Node* c = t ? t->link : root; c; c = c->next) order[tail++] = c;
 
-            // Printing the the node itself.
-            for (int i = 0; i < n->len; i++) { if (segmentsFile) segmentsFile << n->key[i]; if (echo) cout << n->key[i]; }
+    }
 
-            if (segmentsFile) segmentsFile << endl; if (echo) cout << endl;
+    // Label offsets are 32-bit in the format, so a tree with 4 GiB of keys or more cannot be laid out at all (node...
+    // ...indices always fit, the node count being an "int")
 
-        } else {
+    if (labelBytes > UINT32_MAX) {
+        free(order);
+        size = 0;
+        return 0;
+    }
+
+    size = sizeof(RadixSnapshot::Header) + (total + 1) * sizeof(RadixSnapshot::Record) + labelBytes;
+    char* block = (char*) malloc(size);
+
+    RadixSnapshot::Header* header = (RadixSnapshot::Header*) block;
+    RadixSnapshot::Record* records = (RadixSnapshot::Record*) (block + sizeof(RadixSnapshot::Header));
+    char* labels = (char*) (records + total + 1);
+
+    memcpy(header->magic, RadixSnapshot::MAGIC, sizeof(header->magic));
+    header->byteOrder = RadixSnapshot::ORDER_MARK;
+    header->version = RadixSnapshot::VERSION;
+    header->nodeCount = nodeCount;
+    header->stringCount = stringCount;
+    header->labelBytes = (uint32_t) labelBytes;
+    header->unused = 0;
 
-            // If the node has children, create a new prefix that contains the previous prefix and the current node.
-            char* newPrefix = new char[n->len + pLen];
+    // Second pass: the records and labels, the children of record "i" being the next ones after those of "i - 1"
 
-            // Inserting the characters of the node's prefix.
-            for (int i = 0; i < pLen; i++)
-                newPrefix[i] = p[i];
+    uint32_t label = 0;
+    int child = 1;
 
-            // Inserting the characters of the node itself.
-            for (int i = 0; i < n->len; i++)
-                newPrefix[i + pLen] = n->key[i];
+    for (int i = 0; i < total; i++) {
 
-            // Visit current node's children and pass the newly created prefix.
-            sortAndPrintStringsAux(n->link, echo, newPrefix, n->len + pLen);
+        Node* t = order[i];
+        RadixSnapshot::Record& r = records[i];
 
-            // Then deallocate its memory when done.
-            delete[] newPrefix;
+        r.label = label;
+        r.count = t ? t->count : stringCount;
+        r.first = t ? (uint8_t) t->key()[0] : 0;
+        r.unused = 0;
 
+        if (t) {
+            memcpy(labels + label, t->key(), t->len);
+            label += t->len;
         }
+
+        r.firstChild = child;
+        for (Node* c = t ? t->link : root; c; c = c->next) child++;
+        r.childCount = (uint16_t) (child - r.firstChild);
+
     }
 
-    // De-allocate array of nodes.
-    delete[] arr;
-}
+    RadixSnapshot::Record& sentinel = records[total];
+    sentinel.label = (uint32_t) labelBytes;
+    sentinel.firstChild = child;
+    sentinel.count = 0;
+    sentinel.childCount = 0;
+    sentinel.first = 0;
+    sentinel.unused = 0;
+
+    free(order);
 
-void RadixTree::printNodeWithPrefix(Node* n, char* p, int pLen, bool echo) {
+    return block;
 
-    // First we check if node has a prefix, because if so, we print it, followed by a separator
-    if (pLen) {
+}
 
-        for (int i = 0; i < pLen; i++) { if (nodesFile) nodesFile << p[i]; if (echo) cout << p[i]; }
-        if (nodesFile) nodesFile << " | "; if (echo) cout << " | ";
+// Snapshot saving function, writes out the block in one go
+bool RadixTree::save(const char* path) {
 
-    }
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) return false;
 
-    // Then we check if node is empty (key is only a null character; means end of a string) and if so we print (NULL) and terminate function
-    if (n->key[0] == 0) { if (nodesFile) nodesFile << "(NULL)\n"; if (echo) cout << "(NULL)\n"; return; }
+    size_t size;
+    char* block = buildSnapshot(size);
+    if (!block) return false;
 
-    // Otherwise if it is not empty, we print its key, character by character, since some nodes may not have a null terminator
-    for (int i = 0; i < n->len; i++) { if (nodesFile) nodesFile << n->key[i]; if (echo) cout << n->key[i]; }
+    out.write(block, size);
+    free(block);
 
-    // And finally a line break
-    if (nodesFile) nodesFile << endl;
-    if (echo) cout << endl;
+    return (bool) out.flush();
 
 }
 
-void RadixTree::printNodesAux(Node* t, bool echo) {
+// Snapshot freezing function, the snapshot takes over the block as it is
+RadixSnapshot* RadixTree::freeze() {
 
-    static char* p; // Character array to contain node prefix
-    static int v, pLen; // "v": The number of nodes already visited, "pLen": The length of prefix
+    size_t size;
+    char* block = buildSnapshot(size);
 
-    if (t == root) v = 0; // If commencing a new test, which can be concluded if current node is the root, re-initialize "v"
+    // "adopt" turns a NULL block away too
+    return RadixSnapshot::adopt(block, size);
+
+}
 
-    if (nodesFile) nodesFile << "Node #" << v << " - "; // Printing into output file
-    if (echo) cout << "Node #" << v << " - "; // Printing into console, is very slow
+// Snapshot mapping function, the snapshot does all the work itself
+RadixSnapshot* RadixTree::mapSnapshot(const char* path) {
+    return RadixSnapshot::open(path);
+}
 
-    v++; // Incrementing the visited nodes counter as we've already printed the number
+// Succinct export function, appends the nodes to a new index in breadth-first order, which is the order LOUDS uses
+SuccinctRadixIndex* RadixTree::exportSuccinct() {
 
-    printNodeWithPrefix(t, p, pLen, echo); // Printing the node along with its respective prefix
+    // "order[i]" is node "i" of the index, 0 being the virtual root (hence the NULL)
+    // The "\0" leaves are never queued: the index stores them as the terminal flag of their parent instead
 
-    // And now, we want to add the current node's key to the prefix so that when we visit its child its prefix is full
+    Node** order = (Node**) malloc((nodeCount + 1) * sizeof(Node*));
+    SuccinctRadixIndex* index = new SuccinctRadixIndex();
 
-    p = (char*) realloc(p, sizeof(char) * (pLen + t->len)); // But before addition the character array needs re-allocation
+    int tail = 1;
+    order[0] = 0;
 
-    // The loop below adds the key of the current node "t" to the prefix, while maintaining the value it has at this moment
-    // It does that by simultaneously incrementing the variable representing prefix length, "pLen", while using it as index
+    for (int head = 0; head < tail; head++) {
 
-    for (int i = 0; i < t->len; i++) p[pLen++] = t->key[i];
+        Node* t = order[head];
 
-    if (t->link != 0) printNodesAux(t->link, echo); // Recursive call to visit all the children of the node "t" (if exists)
+        // A leaf's key ends with the null terminator, which is not part of the label in the index
 
-    pLen -= t->len; // Decrementing "pLen" to remove the key of the node "t" from the prefix since we're visiting a sibling
+        const char* label = t ? t->key() : "";
+        int len = t ? t->len : 0;
+        bool end = t && !t->link;
+        if (end) len--;
 
-    if (t->next != 0) printNodesAux(t->next, echo); // Recursive call to visit all the siblings of the node "t" (if exists)
+        int children = 0;
 
-    if (t == root) { // If the pointers match then "t" is indeed the root node, meaning that recursion is now complete
+        for (Node* c = t ? t->link : root; c; c = c->next) {
+            if (!c->link && c->len == 1) end = true;
+            else { order[tail++] = c; children++; }
+        }
 
-        free(p); // Finally, as prefix/node printing is now over, free the memory allocated for the static array "p"
-        p = 0; // Then re-initialize it to a null pointer for potential future re-usage of the static array "p"
+        if (!index->append(label, len, children, end)) {
+            delete index;
+            free(order);
+            return 0;
+        }
 
     }
 
+    index->build();
+    free(order);
+
+    return index;
+
 }
 
-void RadixTree::printTreeAux(const Node* t, int pLen, bool echo) {
+// Tree sorting function, sorts the nodes of the current Radix Tree alphabetically in ascending order
+void RadixTree::sortRadixTree() {
+    root = sortRadixTreeAux(root);
+}
 
-    // Allocate two boolean arrays, "p" and "temp", which will be used as follows:
-    // "p" will be used in the tree visualization process to determine which character set to use for prefixes.
-    // "temp" will be used in dynamically resizing "p", mechanism explained further down in this function's code.
+// Iterator copy constructor, gives the copy its own path and buffer
+RadixTree::iterator::iterator(const iterator& other)
+    : path(0), offsets(0), depth(0), capacity(0), bounded(false), buffer(0), bufferSize(0) {
+    *this = other;
+}
 
-    static bool* p, * temp;
+// Iterator assignment, copies the path and the current string
+RadixTree::iterator& RadixTree::iterator::operator=(const iterator& other) {
 
-    {	// This part is in a scope of its own since it is only concerned with printing and does not affect "p" or "temp".
+    if (this == &other) return *this;
 
-        // This loop is responsible for printing out the character set based on the value of "p". It always starts printing its content
-        // prior to other operations; hence why "p" is also referred to as "The Prefix". The usage and choosing of these character sets
-        // will also be explained further down in this function's code, for now we're concerned with the printing operation(s) only.
-        //
-        for (int i = 0; i < pLen; i++) {
+    depth = 0;
+    bounded = other.bounded;
 
-            // Prints to the tree file.		
-            if (treeFile) treeFile << (p[i] ? "│   " : "    ");
+    for (int i = 0; i < other.depth; i++) push(other.path[i], other.offsets[i]);
 
-            // Prints to the console, given echo is true.
-            if (echo) cout << (p[i] ? "│   " : "    ");
-        }
+    if (other.depth) {
+        bufferSize = other.bufferSize;
+        buffer = (char*) realloc(buffer, bufferSize);
+        memcpy(buffer, other.buffer, bufferSize);
+    }
 
-        // This line prints a special set of characters that represent whether the node has siblings or it is the last sibling.
-        // It should be noted that the special characters chosen do not appear as intended on the Windows "cmd" console, due to
-        // being part of the extended ASCII character set which is not supported on it. Anyway, some IDEs have their own custom
-        // output consoles, so it is advised to switch to them if this issue were to occur for correct tree visualization.
-        //
-        // In any case though, the text file should provide the correct visualization, provided the right encoding.
-        //
-        // Example of the different evaluations for the following conditionals:
-        // ...
-        // ├───TGGTTGA
-        // ├───CTT
-        // └───GCCCC
-        //        
-        if (treeFile) treeFile << ((t->next != 0) ? "├───" : "└───");
-
-        // Prints to the console, given echo is true.
-        if (echo) cout << ((t->next != 0) ? "├───" : "└───");
-
-        // Loop responsible for printing out the key of a node.
-        // First, check if the node key is null. If it is, prints (NULL) to prevent empty tree branches.
-        if (t->key[0] == 0) {
-
-            // Prints to the tree file.
-            if (treeFile) treeFile << "(NULL)\n";
-
-            // Prints to the console, given echo is true.
-            if (echo) cout << "(NULL)\n";
-
-        // Otherwise, proceed with printing the node's key character by character.
-        // We don't simply pass the pointer to the output stream(s), since not all nodes have a null terminator.
-        } else {
+    return *this;
 
-            for (int i = 0; i < t->len; i++) {
+}
 
-                // Prints the content of the node, including the final null character if it exists, given first was not null.
-                if (treeFile) treeFile << t->key[i];
+// Iterator path extension function, grows the path arrays as needed
+void RadixTree::iterator::push(Node* t, int offset) {
 
-                // Prints to the console, given echo is true
-                if (echo) cout << t->key[i];
+    if (depth == capacity) {
+        capacity = capacity ? 2 * capacity : 16;
+        path = (Node**) realloc(path, capacity * sizeof(Node*));
+        offsets = (int*) realloc(offsets, capacity * sizeof(int));
+    }
 
-            }
+    path[depth] = t;
+    offsets[depth] = offset;
+    depth++;
 
-            // Prints a new line
-            if (treeFile) treeFile << endl;
-            if (echo) cout << endl;
+}
 
-        }
+// Iterator start function, lays down whatever comes before node "t" in the buffer then goes down to the first leaf
+void RadixTree::iterator::start(Node* t, const char* before, int offset, bool onlySubTree) {
+
+    depth = 0;
+    bounded = onlySubTree;
+
+    if (offset > bufferSize) {
+        bufferSize = 2 * offset;
+        buffer = (char*) realloc(buffer, bufferSize);
     }
 
-    // The following part chooses whether to append the special character set "│   " or four spaces "    " to branches of the tree.
-    //
-    // Example of the final output:
-    // 1- In case of choosing "│   ":
-    //
-    // ...
-    // │   ├───T
-    // │   │   ├───CTT
-    // ...
-    //
-    // 2- In case of choosing "    ":
-    //
-    // ...
-    // │       │       └───A
-    // │       └───G
-    // ...
-    //
-    // Of course, the size of the boolean array needs to be increased by one unit to be able to store the previous choices made.
-    // The eight following lines of code cover the procedure of increasing the array's size while maintaining its data.
-    // An example explaining how they operate in this recursive environment can be found at the end of this file.
+    if (offset) memcpy(buffer, before, offset);
 
-    // Allocate memory for the temporary boolean array for "pLen" boolean values for the prefix choices.
-    temp = new bool[pLen];
+    push(t, offset);
+    descend();
 
-    // Copy the content that currently exists in the prefix into the temporary array.
-    for (int i = 0; i < pLen; i++) temp[i] = p[i];
+}
 
-    // Delete whatever the prefix is pointing at currently.
-    delete[] p;
+// Iterator descent function, follows the first child of every node (the smallest one) down to a leaf
+void RadixTree::iterator::descend() {
 
-    // Now expand the prefix by one unit (the new choice to be added).
-    p = new bool[pLen + 1];
+    while (true) {
 
-    // Now fill it with its original data (first pLen iterations) then in the last iteration,
-    // add the new choice to be stored, which is made based on whether a sibling exists or not.
-    // The choice "true" means we've chosen "│   " because "next" was not null (i.e. sibling exists),
-    // while the choice "false" means we've chosen "    " because "next" was null (i.e. sibling doesn't).
-    // The printing loop visited earlier knows what "true" and "false" are associated with and prints accordingly.
-    for (int i = 0; i < pLen + 1; i++) p[i] = (i < pLen) ? temp[i] : (t->next != 0);
+        Node* t = path[depth - 1];
+        int offset = offsets[depth - 1];
 
-    // Finally, de-allocate the temporary array, as it is no longer useful to us, and will be re-initialized the next iteration.
-    delete[] temp;
+        // Copy the node's key right after its prefix, growing the buffer if needed
 
-    // Now, make a recursive call to the function to traverse on to the first child using the new content of "p", provided that one exists.
-    // It should be noted that the size is sent as "pLen + 1" rather than increment "pLen" so "p" would be as it is now after returning,
-    // while the child is sent the full prefix (i.e. old prefix + what we just appended to it) as it is in the next level of the tree.
-    if (t->link != 0) printTreeAux(t->link, pLen + 1, echo);
+        if (offset + t->len > bufferSize) {
+            bufferSize = 2 * (offset + t->len);
+            buffer = (char*) realloc(buffer, bufferSize);
+        }
 
-    // Once done with all children (and their siblings), we return to this function with the prefix length as it was before leaving.
-    // Now, we make a recursive call to the next sibling of the node to keep iterating through them with the same prefix.
-    // This is provided that a sibling does exist. If not, resume function execution.
-    if (t->next != 0) printTreeAux(t->next, pLen, echo);
+        memcpy(buffer + offset, t->key(), t->len);
 
-    // Finally, check if we're at the very first function call (via checking if "t" is root). If so, nullify the prefix.
-    if (t == root) { delete[] p; p = 0; }
+        // A node without children is a leaf, whose key ends with the null terminator: the string is complete
+        if (!t->link) return;
 
-    // Afterwards the function terminates and the stack is popped (i.e. parent function may now resume execution).
-    // An example of the final output of the function can be found in the function declaration in RadixTree.h
+        push(t->link, offset + t->len);
 
-}
+    }
 
-// Addition function, updates root with a new root containing the string to be added
-void RadixTree::addString(char* str) {
-    root = insert(root, str);
 }
 
-// Deletion function, updates root with a new root that does not contain the string to be deleted
-void RadixTree::deleteString(char* str) {
-    root = remove(root, str);
-}
+// Iterator increment function, moves to the next sibling of the deepest node that has one, then down to its first leaf
+RadixTree::iterator& RadixTree::iterator::operator++() {
 
-// Searching function returns, boolean value based on the result of the finder function
-bool RadixTree::searchString(char* str) {
-    return find(root, str) != 0;
-}
+    while (depth) {
+
+        Node* t = path[depth - 1];
+
+        if (t->next && !(bounded && depth == 1)) {
+            path[depth - 1] = t->next;
+            descend();
+            return *this;
+        }
+
+        depth--;
+
+    }
+
+    return *this;
 
-// String counting function, returns the total number of string in the current Radix Tree
-int RadixTree::countStrings() {
-    return countStringsAux(root);
 }
 
-// Node counting function, returns the total number of nodes in the current Radix Tree
-int RadixTree::countNodes() {
-    return countNodesAux(root);
+// Iterator comparison, two iterators are equal if both are at the end or both are at the same leaf
+bool RadixTree::iterator::operator==(const iterator& rhs) const {
+    if (!depth || !rhs.depth) return depth == rhs.depth;
+    return path[depth - 1] == rhs.path[rhs.depth - 1];
 }
 
-// Tree sorting function, sorts the nodes of the current Radix Tree alphabetically in ascending order
-void RadixTree::sortRadixTree() {
-    root = sortRadixTreeAux(root);
+// Iteration start function, returns an iterator at the alphabetically first string (or the end iterator if empty)
+RadixTree::iterator RadixTree::begin() {
+
+    iterator it;
+    if (root) it.start(root, 0, 0, false);
+
+    return it;
+
 }
 
-// String fetching function, returns all strings that can be found in current Radix Tree, has the option to sort them or not
-char** RadixTree::fetchStrings(bool echo, bool sort) {
+// String fetching function, returns all strings that can be found in current Radix Tree, always in alphabetical order
+// (The second parameter, "sort", is a no-op: see the header)
+char** RadixTree::fetchStrings(bool echo, bool /* sort */) {
 
     if (echo) cout << "String Count: " << countStrings() << "\nNote: Duplicate strings are prohibited in the Radix Tree.\n\n";
 
-    char** strings = fetchStringsAux(root, echo, sort);
+    char** strings = (char**) calloc(stringCount, sizeof(char*));
+    int i = 0;
+
+    // The iterator already produces the strings in alphabetical order, so they only need copying out of its buffer
+
+    for (iterator it = begin(); it != end(); ++it, i++) {
+
+        int n = it.length() + 1;
+        strings[i] = (char*) malloc(n);
+        memcpy(strings[i], *it, n);
+
+        if (echo) cout << i << ". " << strings[i] << endl;
+
+    }
 
     return strings;
 
@@ -801,48 +2093,44 @@ char** RadixTree::fetchStrings(bool echo, bool sort) {
 // String printing function, prints strings in tree sorted in alphabetical order
 void RadixTree::sortAndPrintStrings(const char* address, bool echo) {
 
-    if (*address) segmentsFile.open(address);
-
-    int stringsNum = countStrings();
+    ExportBuffer out(address, echo);
+    if (!out.active()) return;
 
-    if (segmentsFile) segmentsFile << "String Count: " << stringsNum << "\nNote: Duplicate strings are prohibited in the Radix Tree.\n\n";
-    if (echo) cout << "String Count: " << stringsNum << "\nNote: Duplicate strings are prohibited in the Radix Tree.\n\n";
+    out.write("String Count: ");
+    out.writeNumber(countStrings());
+    out.write("\nNote: Duplicate strings are prohibited in the Radix Tree.\n\n");
 
-    sortAndPrintStringsAux(root, echo);
+    // Siblings are kept in alphabetical order, so the iterator already goes through the strings sorted, building each...
+    // ...one in its own re-used buffer; the leaf's null terminator is written along with the string, then a line break
 
-    if (*address) segmentsFile.close();
+    for (iterator it = begin(); it != end(); ++it) {
+        out.write(*it, it.length() + 1);
+        out.put('\n');
+    }
 
 }
 
 // Node printing function, prints node count, individual nodes, with their respective prefixes
 void RadixTree::printNodes(const char* address, bool echo) {
 
-    if (*address) nodesFile.open(address);
-
-    int nodesNum = countNodes();
+    ExportBuffer out(address, echo);
+    if (!out.active()) return;
 
-    if (nodesFile) nodesFile << "Node Count: " << nodesNum << "\n";
-    if (echo) cout << "Node Count: " << nodesNum << "\n";
+    out.write("Node Count: ");
+    out.writeNumber(countNodes());
+    out.write("\nNote: For nodes with prefixes, the prefix is printed before the node key and they are separated by the \"|\" character.\n\n");
 
-    if (nodesFile) nodesFile << "Note: For nodes with prefixes, the prefix is printed before the node key and they are separated by the \"|\" character.\n\n";
-    if (echo) cout << "Note: For nodes with prefixes, the prefix is printed before the node key and they are separated by the \"|\" character.\n\n";
-
-    printNodesAux(root, echo);
-
-    if (*address) nodesFile.close();
+    printNodesAux(out);
 
 }
 
 // Tree visualization function, prints a visualization of the entire radix tree
 void RadixTree::printTree(const char* address, bool echo) {
 
-    if (*address) treeFile.open(address);
+    ExportBuffer out(address, echo);
+    if (!out.active()) return;
 
-    // The auxiliary tree printing function takes different inputs:
-    // The root node of the current Radix Tree and the prefix data length (explained in detail inside the function)
-    printTreeAux(root, 0, echo);
-
-    if (*address) treeFile.close();
+    printTreeAux(out);
 
 }
 
@@ -1310,128 +2598,3 @@ void RadixTree::printTree(const char* address, bool echo) {
 │                                                                                       │
 └───────────────────────────────────────────────────────────────────────────────────────┘
 */
-
-/*  ┌ Example on Recursive Tree Printing with Dynamic Memory Allocation ┐
-┌───┴───────────────────────────────────────────────────────────────────┴────────────────────────────────────────┐
-│                                                                                                                │
-│  A test that matches the assumptions made in this example can be generated using the following setup:          │
-│  ─ Randomization Seed: 1337                                                                                    │
-│  ─ Min. Segment length: 4                                                                                      │
-│  ─ Max. Segment length: 7                                                                                      │
-│  ─ Number of segments: 10                                                                                      │
-│                                                                                                                │
-│  Upon executing "printTreeAux", first, we have pLen set at 0, and "static bool* p, * temp;" which gives us:    │
-│  p ──> [], temp ──> [], pLen = 0                                                                               │
-│                                                                                                                │
-│  They will not be instantiated again for the lifetime of this program.                                         │
-│  Now let's proceed with the function, skip the part concerning printing...                                     │
-│                                                                                                                │
-│  "temp" is resized to have size pLen (= 0 at this step)                                                        │
-│  temp ──> [?], pLen = 0                                                                                        │
-│                                                                                                                │
-│  The loop sets the first "pLen" characters in "temp" as "p" (= 0 at this step, i.e. no changes), so:           │
-│  temp ──> [?], pLen = 0                                                                                        │
-│                                                                                                                │
-│  At this point, "p" is no longer needed, so we de─allocate its memory                                          │
-│  p ──> garbage, pLen = 0                                                                                       │
-│                                                                                                                │
-│  Now we allocate "pLen + 1 (= 1 at this step)" bool slots for p                                                │
-│  p ──> [?], pLen = 0                                                                                           │
-│                                                                                                                │
-│  Next, we copy "pLen" bool values from "temp" into "p" then add a true or false according to the situation     │
-│  p ──> [true], pLen = 0                                                                                        │
-│                                                                                                                │
-│  And at this point, "temp" is no longer needed, so we de─allocate its memory                                   │
-│  temp ──> garbage, pLen = 0                                                                                    │
-│                                                                                                                │
-│  The value of pLen makes sense at this point, since for this function (the root function), there's no prefix   │
-│  That is because root nodes have no prefix tree symbols before the "├───"                                      │
-│  Notice how the prefix itself, however, is actually of length 1                                                │
-│  Hence, upon proceeding to a child, we send it "pLen + 1"                                                      │
-│                                                                                                                │
-├────────────────────────────────── Assuming a child does exist, we will proceed ────────────────────────────────┤
-├──────────────────── Here we recurse, sending the function the first child and pLen + 1 (= 1) ──────────────────┤
-│                                                                                                                │
-│  First, we now have:                                                                                           │
-│  p ──> [true], temp ──> garbage, pLen = 1 (which means 1 character set got printed)                            │
-│                                                                                                                │
-│  We now allocate new memory for the "temp" array with size pLen (= 1 at this step)                             │
-│  temp ──> [?], pLen = 1                                                                                        │
-│                                                                                                                │
-│  The loop sets the first "pLen" bool values in "temp" as "p", so:                                              │
-│  temp ──> [true], pLen = 1                                                                                     │
-│                                                                                                                │
-│  At this point, "p" is no longer needed, so we de─allocate its memory                                          │
-│  temp ──> garbage, pLen = 1                                                                                    │
-│                                                                                                                │
-│  Next we allocate "pLen + 1 (= 2 at this step)" characters for p                                               │
-│  p ──> [?][?], pLen = 1                                                                                        │
-│                                                                                                                │
-│  Next, we copy "pLen" bool values from "temp" into "p" then add a true or false according to the situation     │
-│  If next node exists, we choose "true", otherwise we choose "false". This will be further explained later      │
-│  Let's assume the next node (sibling node) exists, so...                                                       │
-│  p ──> [true][true], pLen = 1                                                                                  │
-│                                                                                                                │
-│  And at this point, "temp" is no longer needed, so we de─allocate its memory                                   │
-│  temp ──> garbage, pLen = 1                                                                                    │
-│                                                                                                                │
-│  Again, the value of pLen for this function makes sense, as this is the root's child, i.e. 2nd tree level      │
-│                                                                                                                │
-│  ───────────── Assuming there is no child, the function skips the first recursive function call ───────────────┤
-│  ───────────────────────── Following the assumption made above, there's a next node ───────────────────────────┤
-│  ────────── Therefore we recurse again, sending the function the next node and the same pLen (= 1) ────────────┤
-│                                                                                                                │
-│  First, we now have:                                                                                           │
-│  p ──> [true][true], temp ──> garbage, pLen = 1                                                                │
-│                                                                                                                │
-│  Same as before, allocate memory for "temp" of size "pLen " then copy "pLen" characters from "p"               │
-│  temp ──> [?], pLen = 1                                                                                        │
-│  temp ──> [true], pLen = 1                                                                                     │
-│                                                                                                                │
-│  Then we delete "p", allocate "pLen + 1" characters, copy all of "temp" then add our choice for this iteration │
-│  p ──> garbage, pLen = 1                                                                                       │
-│  p ──> [?][?], pLen = 1                                                                                        │
-│  p ──> [true][true], pLen = 1                                                                                  │
-│                                                                                                                │
-│  And at this point, "temp" is no longer needed, so we de─allocate its memory                                   │
-│  temp ──> garbage, pLen = 1                                                                                    │
-│                                                                                                                │
-│  ─────────── Let's assume again that there's no child, and skip the first recursive function call ─────────────┤
-│  ───────────── Assuming there is a next node, we recurse again with it, and the same pLen (= 1) ───────────────┤
-│                                                                                                                │
-│  The same exact execution as the previous non─empty function is done here again...                             │
-│  ...except for one thing: Let's assume this node has no next node, meaning that...                             │
-│  ...when choosing which special character set to append to the prefix, we'll go...                             │
-│  ...with the four spaces, the following example should show both choices in action                             │
-│                                                                                                                │
-│          .                                                                                                     │
-│          .                                                                                                     │
-│          .                                                                                                     │
-│                                                                                                                │
-│  │   │   ├───TC... <── Choosing true, i.e. "│   "                                                              │
-│  │   │   └───AT... <── Choosing true, i.e. "│   "                                                              │
-│  │   └───GCC                                                                                                   │
-│  │       ├───AA... <── Choosing false, i.e. "    "                                                             │
-│  │       └───GT... <── Choosing false, i.e. "    "                                                             │
-│  ├───T                                                                                                         │
-│  │   ├───ATCTGT... <── Choosing true, i.e. "│   "                                                              │
-│  │   ├───CATAAC... <── Choosing true, i.e. "│   "                                                              │
-│                                                                                                                │
-│          .                                                                                                     │
-│          .                                                                                                     │
-│          .                                                                                                     │
-│                                                                                                                │
-│  i.e. The four spaces are for the case that there's no next node where there could potentially be children     │
-│                                                                                                                │
-│  After the current function is over, we will have the following values:                                        │
-│                                                                                                                │
-│  p ──> [true][false], temp ──> garbage, pLen = 1                                                               │
-│                                                                                                                │
-│  This function then terminates, popping the stack and allowing its parent function to continue execution       │
-│  Its parent (@pLen = 0) was waiting for its first recursive call to finish, and now commences the second       │
-│  Since we had assumed it had a sibling node, it will go through the second recursive call                      │
-│                                                                                                                │
-│  This recursive cycle repeats until all siblings and children have their prefixes chosen                       │
-│                                                                                                                │
-└────────────────────────────────────────────────────────────────────────────────────────────────────────────────┘
-*/
\ No newline at end of file
@@ -7,10 +7,69 @@
 //---------------------------------------------------------------------------------------------------------------------------------------------
 #ifndef RADIXTREEPROJECT_RADIXTREE_H
 #define RADIXTREEPROJECT_RADIXTREE_H
-#include <fstream>
+#include <ostream>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 using namespace std;
 
+#include "NodeArena.h"
+#include "EpochManager.h"
+#include "MemoryReport.h"
+#include "ExportBuffer.h"
+#include "BloomFilter.h"
+
+class RadixSnapshot;
+class SuccinctRadixIndex;
+
 class RadixTree {
+public:
+
+    // Callback used by the scanning and approximate search functions, called once per string found with the string,...
+    // ...its length (null terminator NOT included) and whatever "context" the caller passed; returning false stops...
+    // ...the search. The string lives in a buffer re-used for the next one, so it must be copied to be kept
+    typedef bool (*Visitor)(const char* str, int len, void* context);
+
+    // Hot-path counters, returned by "stats"
+    //
+    // They are only kept up to date when "RadixTree.cpp" is compiled with "RADIXTREE_STATS" defined; otherwise every...
+    // ...update compiles out and all counters stay at zero ("enabled" tells which one it is). The counters are plain...
+    // ...integers, so a stats build must not be used with concurrent-read mode reader threads
+    //
+    struct Stats {
+
+        // Whether the counters are being kept at all
+        bool enabled;
+
+        // Calls of "find", "insert" and "remove" (i.e. searches, additions and deletions, successful or not)
+        long long lookups, insertions, removals;
+
+        // Nodes whose key was compared during those calls, and how many of them were only skipped over as a sibling
+        long long nodesVisited, siblingHops;
+
+        // Characters compared by "prefix"
+        long long prefixBytes;
+
+        // Calls of "split" and "join"
+        long long splits, joins;
+
+        // Node and key blocks taken from and given back to the allocator (heap or arena), and their sizes in bytes
+        long long allocations, deallocations, bytesAllocated, bytesFreed;
+
+        // Searches turned away by the Bloom filter without walking the tree, and searches it let through that the...
+        // ...tree then did not find (its false positives)
+        long long filterRejects, filterFalsePositives;
+
+        Stats() { memset(this, 0, sizeof(Stats)); }
+
+        // Adds every counter of "other" to this one's (used to gather the counters of a parallel build's workers)
+        Stats& operator+=(const Stats& other);
+
+        // Prints every counter, one per line, along with averages per call of "find" / "insert" / "remove"
+        void print(ostream& out) const;
+
+    };
+
 private:
 
     // Radix Tree's private inner class: Node
@@ -25,48 +84,47 @@ private:
         // ---- The "next" node. This resembles a "sibling" node to the current node, meaning that it is at the same tree level
         Node* next;
 
-        // The value, or "key", of the node, which is not unique per node, and may or may not contain a null terminator
-        char* key;
-
         // Number of characters in the node (includes the null character - if it exists)
         int len;
 
+        // Number of strings in the sub-tree of this node, i.e. the node itself and everything reachable via its "link"...
+        // ...(siblings are NOT included). A leaf always has a count of 1
+        int count;
+
+        // Keys of up to "INLINE_KEY" characters are stored right inside the node, in "label"; only longer keys get a...
+        // ...buffer of their own, pointed at by "heap" which takes the place of the label. Most keys left by splits are...
+        // ...a few characters long, so reading them usually costs no extra cache miss and creating them no allocation
+        static const int INLINE_KEY = 16;
+
+        union {
+            char* heap;
+            char label[INLINE_KEY];
+        } storage;
+
         // Basic constructor, initializes the node members as follows:
         // -- Node length:  n
         // -- Link node:    NULL
         // -- Next node:    NULL
-        // -- Node value:   Loop sets character array
+        // -- Node value:   k, a buffer of "n" characters already allocated (and filled) by the tree, or NULL for a key...
+        //                  ...short enough to be stored inside the node (which the tree then fills)
         //
-        Node(const char* x, int n) : link(0), next(0), len(n) {
-
-            key = new char[len];
-            for (int i = 0; i < len; i++) key[i] = x[i];
-
-        }
-
-        // Shallow Copy constructor, only sets the pointers regarding "link" and "next" in addition to key
-        Node(const Node* orig) : link(orig->link), next(orig->next), len(orig->len) {
-
-            key = new char[len];
-            for (int i = 0; i < len; i++) key[i] = orig->key[i];
-
-        }
-
-        // Deep Copy constructor, clones the original node (i.e. makes this node an exact copy of node "orig")
-        Node(const Node& orig) : len(orig.len) {
+        // Nodes never allocate or free anything themselves; the tree does it for them through "createNode" and...
+        // ..."destroyNode", so that the same node can live either on the heap or inside the tree's arena
+        //
+        Node(char* k, int n) : link(0), next(0), len(n), count(0) { if (n > INLINE_KEY) storage.heap = k; }
 
-            key = new char[len];
-            for (int i = 0; i < len; i++) key[i] = orig.key[i];
-            link = orig.link ? new Node(*orig.link) : 0;
-            next = orig.next ? new Node(*orig.next) : 0;
+        // Whether the key is stored inside the node rather than in a buffer of its own
+        bool inlineKey() const { return len <= INLINE_KEY; }
 
-        }
+        // The value, or "key", of the node, which is not unique per node, and may or may not contain a null terminator
+        char* key() { return inlineKey() ? storage.label : storage.heap; }
+        const char* key() const { return inlineKey() ? storage.label : storage.heap; }
 
         // Equality operator overloading
         bool operator==(const Node& rhs) {
 
             if (len != rhs.len) return false; // Compare lengths first, if they do not match then they can't be equal therefore return false
-            for (int i = 0; i < len; i++) if (key[i] != rhs.key[i]) return false; // Next, compare each character, on conflict return false
+            for (int i = 0; i < len; i++) if (key()[i] != rhs.key()[i]) return false; // Next, compare each character, on conflict return false
             if (*link != *(rhs.link) || *next != *(rhs.next)) return false; // Finally, compare if its first child or sibling are the same
             // Notice that the check above recursively checks all of the children and siblings of these two nodes - aka sub-tree checking
             return true; // If comparison reaches this line then the two nodes are indeed congruent to each other, therefore return true
@@ -76,163 +134,257 @@ private:
         // Inequality operator overloading - just like the naming, it is literally the opposite of the equality operator
         bool operator!=(const Node& rhs) { return !(*this == rhs); }
 
-        // Basic deconstructor, de-allocates memory occupied by node's key, children, and siblings (i.e. its sub-tree)
-        // The sub-tree deletion works via recursive deletion of children and siblings, since calling "delete link"...
-        // ...calls this function again (i.e. undergoes recursion) and the same with "delete next" where ultimately...
-        // ...all of its children and siblings will have been deleted.
-        //
-        ~Node() { delete link; delete next; delete[] key; }
-
     };
 
     // Radix Tree's root node
     Node* root;
 
-    // File streams to print different outputs to their respective files
-    ofstream segmentsFile;
-    ofstream nodesFile;
-    ofstream treeFile;
+    // Arena from which nodes and keys are allocated, NULL if the tree allocates them individually on the heap instead
+    NodeArena* arena;
+
+    // Live number of strings and nodes in the tree, kept up to date by every insertion and removal
+    int stringCount;
+    int nodeCount;
+
+    // Epoch manager used in concurrent-read mode to defer freeing unlinked nodes, NULL if the mode is not enabled
+    EpochManager* epochs;
+
+    // Bloom filter checked by "searchString" before walking the tree, NULL if it is not enabled
+    BloomFilter* bloom;
+
+    // Hot-path counters, only updated in "RADIXTREE_STATS" builds
+    Stats counters;
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Prefix function, responsible for comparing two character arrays "x" and "key"...
-    // ...of lengths "n" and "m" respectively.
+    // Key allocation functions, responsible for getting and giving back a key buffer of "n" characters
+    // They go through the arena if the tree has one, otherwise through "new[]" / "delete[]"
     //
-    int prefix(char* x, int n, char* key, int m);
-    // Returns the number of common prefix characters
+    char* allocateKey(int n);
+    void deallocateKey(char* key, int n);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Finder (Search) function, responsible for finding key "x" in tree of root node "t"
+    // Key replacing function, responsible for giving node "t" the "n" characters of "x" as its new key, stored in...
+    // ...the node if short enough, and giving back its old key's buffer (if it had one). "x" may point into the old key,...
+    // ...as long as "n" is not larger than the old key's length
     //
-    Node* find(Node* t, char* x, int n = 0);
-    // Returns pointer to the node corresponding to "x", if found
+    void replaceKey(Node* t, const char* x, int n);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Splitting function, responsible for splitting a node into two at position "k"
-    // Used as part of the insertion process
+    // Node creation functions, responsible for creating a node whose key is a copy of the "n" characters of "x",...
+    // ...or whose key is the already allocated (and filled) buffer "key" of "n" characters (NULL meaning a key short...
+    // ...enough to be stored in the node, left for the caller to fill)
     //
-    void split(Node* t, int k);
+    Node* createNode(const char* x, int n);
+    Node* createNodeWithKey(char* key, int n);
+    // Returns pointer to the created node, with NULL link and next
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Insertion function, responsible for inserting a node in its right position
+    // Node destruction function, responsible for de-allocating node "t" and its key (but NOT its children or siblings)
     //
-    Node* insert(Node* t, char* x, int n = 0);
-    // Returns pointer to the inserted node
+    void destroyNode(Node* t);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Joining function, responsible for joining a node with its link
-    // Used as part of the removal process
+    // Node retirement function, responsible for getting rid of node "t" once it has been unlinked from the tree
+    // Outside of concurrent-read mode it is destroyed right away, otherwise it is handed to the epoch manager which...
+    // ...destroys it (via "reclaimNode") once no reader can still be looking at it
     //
-    void join(Node* t);
+    void retireNode(Node* t);
+    static void reclaimNode(void* node, void* tree);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Removal function, responsible for removing key "x" in tree of root node "t"
+    // Link reading and publishing functions, responsible for every access to a "link" / "next" pointer (or "root")...
+    // ...that may race with another thread in concurrent-read mode
+    //
+    // "publish" is a release store: everything written into a node before it gets published is visible to any...
+    // ...reader that reaches the node through "acquire", which is the matching acquire load. On common hardware...
+    // ...both compile to plain moves, so single-threaded trees pay nothing for them
     //
-    Node* remove(Node* t, char* x, int n = 0);
-    // Returns pointer to the node that takes place of removed node
+    static Node* acquire(Node* const& p) { return reinterpret_cast<const atomic<Node*>&>(p).load(memory_order_acquire); }
+    static void publish(Node*& p, Node* value) { reinterpret_cast<atomic<Node*>&>(p).store(value, memory_order_release); }
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary string counting function, responsible for counting strings in tree of root node "t"
+    // Auxiliary cloning function, responsible for copying the tree of root node "t" (children and siblings included)
     //
-    int countStringsAux(Node* t);
+    Node* cloneAux(const Node* t);
+    // Returns pointer to the root node of the copy
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary node counting function, responsible for counting nodes in tree of root node "t"
+    // Auxiliary destruction function, responsible for de-allocating the tree of root node "t" one node at a time
+    // Only used for heap-allocated trees, as arena-backed trees simply release their slabs
     //
-    int countNodesAux(Node* t);
+    void destroyAux(Node* t);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary tree sorting function, responsible for sorting the Radix Tree by sorting its different sub-trees...
-    // ...of node linked lists, given the head (initialized as root) of the (sub-)tree(s), i.e. sibling linked lists
+    // Prefix function, responsible for comparing two character arrays "x" and "key"...
+    // ...of lengths "n" and "m" respectively.
     //
-    // It is to be noted that using the function without setting the new root as the return value of the function...
-    // ...leaves us with an outdated root node pointer that may point towards a sub-tree rather than the sorted tree
+    int prefix(const char* x, int n, const char* key, int m);
+    // Returns the number of common prefix characters
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Finder (Search) function, responsible for finding key "x" of "n" characters (null terminator included)
+    // Works in a single loop: skipping a sibling or descending a level only moves a pointer, no recursion involved
+    //
+    Node* find(const char* x, int n);
+    // Returns pointer to the node corresponding to "x", if found
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Batched finder function, responsible for finding each of the "n" null-terminated "queries" (see "searchMany")
+    // Each search takes the same decisions as "find", one node per turn, with up to "SEARCH_GROUP" searches in turns
     //
-    // It is used as part of the string fetching function which provides it a clone tree to sort so as to fetch from
+    void findMany(const char* const* queries, int n, bool* results);
+    // Stores in "results[i]" whether "queries[i]" was found
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Splitting function, responsible for splitting the node "slot" points at into two at position "k"
+    // Used as part of the insertion process
     //
-    // On its own, it will recursively sort the Radix Tree whose root node "head" is provided to the function
+    // In concurrent-read mode the node is not modified in place; a new node replaces it in "slot" instead
     //
-    Node* sortRadixTreeAux(Node* head);
-    // Returns pointer to the root node of the sorted Radix Tree
+    Node* split(Node** slot, int k);
+    // Returns pointer to the node now in "slot", holding the first "k" characters
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary string fetching function, responsible for fetching all the strings in the Radix Tree
-    // This function, along with "sortRadixTreeAux", are alternatives to the following set of functions:
+    // Insertion function, responsible for inserting key "x" of "n" characters (null terminator included) in its...
+    // ...right position, walking the tree in a single loop just like "find"
     //
-    // {"heapifyNodes", "heapSortNodes", "sortAndPrintStringsAux"}
+    bool insert(const char* x, int n);
+    // Returns false if "x" was already in the tree
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Joining function, responsible for joining the node "slot" points at with its link
+    // Used as part of the removal process
     //
-    // When used together they do the same functionality, with the addition that "fetchStrings" returns an array of...
-    // ...the strings that have been fetched, which may or may not be sorted based on the boolean variable "sort"
+    // In concurrent-read mode neither node is modified in place; a new node replaces both of them in "slot" instead
     //
-    // By default (as can be seen in the function declaration), it sorts them first, unless explicitly set not to
+    void join(Node** slot);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Removal function, responsible for removing key "x" of "n" characters (null terminator included) from the...
+    // ...tree, walking the tree in a single loop just like "find"
     //
-    // On its own, it will fetch the strings of the Radix Tree of root node "t" in whatever order they are in
+    bool remove(const char* x, int n);
+    // Returns false if "x" was not in the tree
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Bulk building function, responsible for creating the sibling list of nodes for the sorted, duplicate-free...
+    // ...strings "s[lo]" to "s[hi - 1]", all of which share their first "depth" characters
     //
-    // Do not forget to de-allocate the array returned by this function when done using it as done below
-    // 
-    // // De-allocate the memory allocated for the strings array
-    // for (int i = 0; i < numOfStrings; i++) free(strings[i]);
-    // free(strings);
+    // Every sibling whose strings continue past its own key is pushed onto "stack" (as a node together with its...
+    // ...range and depth), so that its own sibling list of children gets built later on by the caller
     //
-    // Has the option to echo output to console - false by default
+    struct BuildFrame { Node* node; int lo, hi, depth; };
+    Node* buildLevel(const char* const* s, int lo, int hi, int depth, BuildFrame* stack, int& top);
+    // Returns pointer to the first node of the created sibling list
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Grafting function, responsible for attaching the sub-tree of node "sub" (holding "nodes" nodes) under the root
+    // No string in the tree may share its first "k" characters with the strings of "sub", which is what guarantees...
+    // ...that the walk down ends by appending "sub" to a sibling list, possibly after splitting a node on the way
+    //
+    // Sub-trees must be grafted in alphabetical order so that sibling lists stay in alphabetical order too
+    //
+    void graft(Node* sub, int nodes);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Prefix finder function, responsible for finding the node under which all the strings starting with the "m"...
+    // ...characters of "p" are stored, i.e. the first node whose key reaches (or goes past) the end of "p"
+    // "offset" receives the number of characters of "p" that come before that node's key
+    //
+    Node* findPrefix(const char* p, int m, int& offset);
+    // Returns pointer to that node (the root if "m" is 0), or NULL if no string starts with "p"
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Approximate search function, responsible for visiting every string within "k" substitutions (Hamming distance)...
+    // ...or, if "edit" is set, within "k" substitutions, insertions and deletions (edit distance) of "query"
+    //
+    // The tree is walked depth-first on an explicit stack, carrying along every edge label either the number of...
+    // ...mismatches so far or the current row of the edit distance table (only the 2k + 1 cells around the...
+    // ...diagonal are ever computed). As soon as the whole budget is spent, the sub-tree is skipped entirely
     //
-    char** fetchStringsAux(Node* t, bool echo = false, bool sort = true);
-    // Returns pointer to character arrays representing all strings in the Radix Tree of root node "t"
+    int approximateSearch(const char* query, int k, bool edit, Visitor visit, void* context);
+    // Returns the number of strings visited
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // To heapify a subtree rooted with node i which is an index in arr. n is size of heap
+    // Bloom filter rebuilding functions, responsible for replacing the filter with one sized for twice the current...
+    // ...number of strings (and at least 1024) holding exactly the current strings
+    // "checkBloomFilter" only rebuilds it if it is over capacity or mostly stale, and never in concurrent-read mode
     //
-    void heapifyNodes(Node** arr, int n, int i);
+    void rebuildBloomFilter();
+    void checkBloomFilter();
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Node sorting function, responsible for sorting "arr" array of nodes of size "size"
+    // Snapshot building function, responsible for laying the whole tree out in the "RadixSnapshot" format, in a...
+    // ...single "malloc"-ed block whose size is stored in "size"
     //
-    void heapSortNodes(Node** arr, int size);
+    // Nodes are laid out breadth-first so that the children of every node are contiguous (which is what lets the...
+    // ...snapshot binary search them) and the top levels, which every search goes through, are packed together
+    //
+    char* buildSnapshot(size_t& size);
+    // Returns the block, which the caller frees (or hands over to "RadixSnapshot::adopt"), or NULL if the keys of...
+    // ...all nodes take 4 GiB or more, which the format's 32-bit label offsets cannot address
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary string sorting and printing function, responsible for printing all strings in tree of root "t"
-    // The function uses the two functions defined previously to sort them alphabetically
-    // Has the option to echo output to console - false by default
+    // Count adjusting function, responsible for adding "delta" to the count of every node that key "x" of "n"...
+    // ...characters fully passes through on its way down (i.e. every node above the one where "x" ends)
+    // Used by "insert" and "remove" to undo the counts they updated on the way down when they turn out to fail
     //
-    void sortAndPrintStringsAux(Node* t, bool echo = false, char* p = 0, int plen = 0);
+    void adjustCounts(const char* x, int n, int delta);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Node printing function along with its prefix, prints node "n" preceded by its prefix "p", if exists
-    // Has the option to echo output to console - false by default
+    // Auxiliary tree sorting function, responsible for sorting the Radix Tree by sorting its different sub-trees...
+    // ...of node linked lists, given the head (initialized as root) of the (sub-)tree(s), i.e. sibling linked lists
+    //
+    // It is to be noted that using the function without setting the new root as the return value of the function...
+    // ...leaves us with an outdated root node pointer that may point towards a sub-tree rather than the sorted tree
+    //
+    // Sibling lists are kept in alphabetical order by "insert" as it goes, so on a tree built by this class it has...
+    // ...nothing left to do; it is kept for trees whose sibling lists were re-ordered by hand
     //
-    void printNodeWithPrefix(Node* n, char* p, int pLen, bool echo = false);
+    // On its own, it will recursively sort the Radix Tree whose root node "head" is provided to the function
+    //
+    Node* sortRadixTreeAux(Node* head);
+    // Returns pointer to the root node of the sorted Radix Tree
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary node printing function, responsible for printing all nodes in tree of root node "t"
-    // The function uses the function "printNodeWithPrefix" defined above to print individual nodes
-    // Has the option to echo output to console - false by default
+    // Auxiliary node printing function, responsible for printing all nodes of the tree into "out", each one preceded...
+    // ...by its number and its prefix (i.e. the keys of the nodes above it), if it has one
+    // The tree is walked depth-first on an explicit stack, and the prefix of every node is kept in a single buffer in...
+    // ...which each level's key is written over the key of the previous sibling at that level
     //
-    void printNodesAux(Node* t, bool echo = false);
+    void printNodesAux(ExportBuffer& out);
     // ---------------------------------------------------------------------------------------------------------------
 
     // ---------------------------------------------------------------------------------------------------------------
-    // Auxiliary tree printing function, responsible for visualizing the entire tree of root node "t"
-    // The tree is generated horizontally and the function works recursively
-    // Has the option to echo output to console - false by default
-    // By default its output is stored in a text file
+    // Auxiliary tree printing function, responsible for visualizing the entire tree into "out"
+    // The tree is generated horizontally, walking it depth-first on an explicit stack
     //
-    // The function takes three parameters:
-    // 1- Node "t" which is the node to be traversed, initialized as the root node of the Radix Tree to be visualized
-    // 2- Integer "pLen" which is the length of "p", used in loops responsible for printing out tree components
-    // 3- Boolean "echo" which is used in the conditional for printing out to console
+    // The branches drawn before a node ("│   " below a node that still has siblings to come, "    " otherwise) only...
+    // ...depend on its ancestors, so they are kept in a single buffer, ending for every level at a known offset, and...
+    // ...every line starts by copying them in one go
     //
     // An example of the final output of the function could be similar to the following:
     //
@@ -246,39 +398,243 @@ private:
     // ├───CACTAA
     // └───GTACTA
     //
-    void printTreeAux(const Node* t, int pLen, bool echo = false);
+    void printTreeAux(ExportBuffer& out);
     // ---------------------------------------------------------------------------------------------------------------
 
 public:
 
     // Basic constructor, initializes root node to NULL
-    RadixTree() : root(0) {};
+    RadixTree() : root(0), arena(0), stringCount(0), nodeCount(0), epochs(0), bloom(0) {};
 
-    // Parameterized constructor, initializes root node to received node
-    RadixTree(Node* r) : root(r) {};
+    // Allocator-backed constructor, if "useArena" is true then all nodes and keys of this tree come from its own slabs
+    // Such a tree is destroyed or cleared by releasing its slabs as a whole rather than visiting every node
+    //
+    explicit RadixTree(bool useArena)
+        : root(0), arena(useArena ? new NodeArena() : 0), stringCount(0), nodeCount(0), epochs(0), bloom(0) {};
 
     // Copy constructor, creates a clone of the provided Radix Tree by copying all of its nodes recursively
-    // It is based on copying the contents of the root node of the original Radix Tree to this one's root node
-    // This simple assignment is all we need, since the copy constructor of nodes copies the first child & sibling
-    // Consequently, "copying" the first child & sibling leads to them copying their own, recursively copying all nodes
+    // The clone uses the same allocation mode as the original (i.e. it gets an arena of its own if the original has one)
+    // The clone does NOT inherit concurrent-read mode or the Bloom filter, they have to be enabled on it separately if needed
     //
-    RadixTree(const RadixTree* orig) { root = (orig->root ? new Node(*orig->root) : 0); };
+    RadixTree(const RadixTree* orig)
+        : root(0), arena(orig->arena ? new NodeArena() : 0), stringCount(0), nodeCount(0), epochs(0), bloom(0) {
+        root = cloneAux(orig->root);
+        stringCount = orig->stringCount;
+    };
 
     // Destructor, responsible for de-allocating memory occupied by Radix Tree
-    // Its implementation is similar to the one above, where deleting the root node is responsible for deleting all the other nodes
+    ~RadixTree() { disableBloomFilter(); clear(); delete epochs; delete arena; };
+
+    // Concurrent-read mode, must be enabled before any reader thread starts using the tree
+    //
+    // Once enabled, ONE writer thread may keep calling "addString" / "deleteString" while any number of other...
+    // ...threads call "searchString" without any locking. Splits and joins build new nodes and publish them with a...
+    // ...single pointer store instead of editing nodes in place, and unlinked nodes are freed only once every reader...
+    // ...that might have seen them is done (epoch-based reclamation).
+    //
+    // Every other function (counting, fetching, sorting, printing, order statistics...) is NOT safe to call while the...
+    // ...writer is active, and "clear" / destruction require all readers to have finished.
+    //
+    void enableConcurrentReads();
+
+    // Bloom filter front-end, lets "searchString" turn most absent strings away after touching a single cache line
+    //
+    // Once enabled, every string added is also added to a blocked Bloom filter (see "BloomFilter") of about...
+    // ..."bitsPerString" bits per string, and searches only walk the tree if the filter lets them through. Strings...
+    // ...present in the tree are never turned away. The filter is rebuilt from the tree (calling "enable" again...
+    // ...does the same) whenever it holds twice as many strings as it was sized for, or when more than half of its...
+    // ...strings have been deleted since, which keeps it between "bitsPerString" and twice that many bits per string.
+    //
+    // In concurrent-read mode readers may use the filter while the writer adds to it, but it is never rebuilt...
+    // ...automatically (readers could still be looking at the old one): its false positive rate slowly rises instead,...
+    // ...until "enableBloomFilter" is called again while no reader is active.
+    //
+    // "bloomFilter" returns the filter (NULL if disabled), for its size ("bytes") and false positive rate
+    //
+    void enableBloomFilter(int bitsPerString = 10);
+    void disableBloomFilter();
+    const BloomFilter* bloomFilter() const { return bloom; }
+
+    // Clearing function, removes all strings from the tree (releasing the arena's slabs at once, if it has one)
+    void clear();
+
+    // Forward iterator over the strings of the tree in alphabetical order
+    //
+    // The strings are produced one at a time, by walking down to the next leaf, into a prefix buffer owned by the...
+    // ...iterator and re-used from one string to the next: nothing is cloned, sorted or gathered up front, so...
+    // ...iterating can stop at any point. The string an iterator points at is only valid until it moves on.
+    //
+    // Adding or removing strings invalidates every iterator, and iterating is NOT safe while a concurrent-read...
+    // ...mode writer is active
+    //
+    // Example:
     //
-    ~RadixTree() { delete root; };
+    // for (RadixTree::iterator it = rt->begin(); it != rt->end(); ++it) cout << *it << endl;
+    //
+    class iterator {
+    private:
+
+        friend class RadixTree;
+
+        // Nodes from the top level down to the current leaf, and where each one's key starts in "buffer"
+        Node** path;
+        int* offsets;
+        int depth;
+        int capacity;
+
+        // Whether iteration is limited to the sub-tree of the first node of "path" (i.e. never moves on to its siblings)
+        bool bounded;
+
+        // The current string, built from the keys along "path" (the leaf's key brings the null terminator)
+        char* buffer;
+        int bufferSize;
+
+        // Descends from the last node of "path" to the leftmost leaf beneath it, filling "buffer" on the way
+        void descend();
+
+        // Appends node "t" (whose key starts at "offset" in "buffer") to "path"
+        void push(Node* t, int offset);
+
+        // Starts iterating from node "t", the "offset" characters before it being "before" (e.g. a searched prefix)
+        void start(Node* t, const char* before, int offset, bool onlySubTree);
+
+    public:
+
+        // Basic constructor, creates the end iterator
+        iterator() : path(0), offsets(0), depth(0), capacity(0), bounded(false), buffer(0), bufferSize(0) {}
+
+        // Copy constructor and assignment, the copy gets buffers of its own
+        iterator(const iterator& other);
+        iterator& operator=(const iterator& other);
+
+        ~iterator() { free(path); free(offsets); free(buffer); }
+
+        // The current string, and its length (null terminator NOT included)
+        const char* operator*() const { return buffer; }
+        int length() const { return offsets[depth - 1] + path[depth - 1]->len - 1; }
+
+        // Moves on to the next string in alphabetical order (or to the end)
+        iterator& operator++();
+        iterator operator++(int) { iterator old(*this); ++*this; return old; }
+
+        bool operator==(const iterator& rhs) const;
+        bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+
+    };
+
+    iterator begin();
+    iterator end() { return iterator(); }
 
     // Publicly usable functions, names self-explanatory
-    void addString(char* str);
-    void deleteString(char* str);
-    bool searchString(char* str);
+    void addString(const char* str);
+    void deleteString(const char* str);
+    bool searchString(const char* str);
     int countStrings();
     int countNodes();
     void sortRadixTree();
+
+    // Statistics functions, "stats" returns a copy of the hot-path counters (see "Stats"), "resetStats" zeroes them
+    Stats stats() const;
+    void resetStats();
+
+    // Memory report function, breaks down the memory taken by the tree and describes its shape (see "MemoryReport")
+    // It walks every node once, without allocating anything but its own stack of sibling lists still to be visited
+    MemoryReport memoryReport();
+
+    // String fetching function, returns a "calloc"-ed array of "countStrings()" "malloc"-ed strings, which the caller...
+    // ...de-allocates with "free". Strings always come out in alphabetical order, since siblings are kept sorted; use...
+    // ..."begin" / "end" instead to go through them without copying them all
+    // "sort" is a no-op, whatever its value: it is only kept so that existing callers still compile
     char** fetchStrings(bool echo = false, bool sort = true);
 
-    // Printing functions, take the address of the file to print to and a console echo option
+    // Same as above, for callers that already know the length "len" of "str" (null terminator NOT included)
+    // The string must still be null-terminated (i.e. str[len] == 0), the length only saves measuring it again
+    void addString(const char* str, int len);
+    void deleteString(const char* str, int len);
+    bool searchString(const char* str, int len);
+
+    // Batched searching function, sets "results[i]" to "searchString(queries[i])" for each of the "n" queries
+    //
+    // A single search is a chain of cache misses, each node's address only being known once the previous node has...
+    // ...arrived. Here, up to "SEARCH_GROUP" searches are in flight at once and taken in turns: each turn moves one...
+    // ...search by one step, then prefetches the node (or the out-of-node key) it needs next and moves on to the...
+    // ...next search, so that by the time a search gets its turn again its memory has most likely arrived. The...
+    // ...misses of different searches overlap instead of being waited for one after another.
+    //
+    // In concurrent-read mode the whole batch counts as a single reader
+    //
+    static const int SEARCH_GROUP = 16;
+    void searchMany(const char* const* queries, int n, bool* results);
+
+    // Bulk addition function, adds all the strings in the range ["begin", "end") at once
+    //
+    // If the tree is empty, the strings are sorted (unless "sorted" says they already are), duplicates are dropped,...
+    // ...and the tree is built top-down in a single pass using the longest common prefixes of adjacent strings, so...
+    // ...every node is created exactly once with its final key and siblings end up in alphabetical order.
+    // If the tree already holds strings, they are simply added one by one.
+    //
+    // The strings themselves are only read, never modified or kept
+    //
+    void addStrings(const char* const* begin, const char* const* end, bool sorted = false);
+
+    // Parallel bulk addition function, adds all the strings in the range ["begin", "end") using "threads" threads...
+    // ...(0 meaning one per hardware thread)
+    //
+    // If the tree is empty, the strings are partitioned by their first "k" bases into 4^k buckets, the buckets are...
+    // ...built independently on the threads using the regular insertion logic, and the resulting sub-trees are then...
+    // ...stitched under the root in alphabetical order, splitting nodes where neighbouring buckets share a prefix.
+    // Strings shorter than "k" or not starting with "k" of A, C, G, T are added afterwards one by one.
+    // If the tree already holds strings, they are simply added one by one.
+    //
+    void addStringsParallel(const char* const* begin, const char* const* end, int threads = 0, int k = 4);
+
+    // Order statistics, all of them O(depth) thanks to the per-node string counts:
+    // -- rank:   number of strings in the tree that come before "str" alphabetically ("str" itself need not be in the tree)
+    // -- select: the string at 0-based position "i" in alphabetical order, NULL if "i" is out of range
+    // -- sample: a string picked uniformly at random (using "rand"), NULL if the tree is empty
+    // The strings returned by "select" and "sample" must be de-allocated by the caller using "free"
+    //
+    int rank(const char* str);
+    char* select(int i);
+    char* sample();
+
+    // Prefix scan functions:
+    // -- countWithPrefix:    number of strings starting with "prefix", O(length of "prefix") thanks to the per-node counts
+    // -- forEachWithPrefix:  calls "visit" on every string starting with "prefix", in alphabetical order, stopping early...
+    //                        ...if "visit" returns false; returns the number of strings visited
+    // Only the sub-tree under "prefix" is ever visited. An empty prefix covers the whole tree
+    //
+    int countWithPrefix(const char* prefix);
+    int forEachWithPrefix(const char* prefix, Visitor visit, void* context = 0);
+
+    // Approximate search functions, call "visit" (if given) on every string in alphabetical order that is:
+    // -- searchHamming:  of the same length as "query", and differs from it in at most "k" positions
+    // -- searchEdit:     at most "k" single-character substitutions, insertions or deletions away from "query"
+    // Both return the number of strings visited, and skip every sub-tree as soon as its prefix alone exceeds "k"
+    //
+    int searchHamming(const char* query, int k, Visitor visit = 0, void* context = 0);
+    int searchEdit(const char* query, int k, Visitor visit = 0, void* context = 0);
+
+    // Snapshot functions:
+    // -- save:         writes the whole tree to the file at "path" in the "RadixSnapshot" format, returns false if the...
+    //                  ...file cannot be written or the tree is too large for the format (4 GiB of keys or more)
+    // -- mapSnapshot:  maps a file written by "save" read-only and returns it ready to be searched in place, without...
+    //                  ...building any tree; returns NULL if the file is missing or invalid. The caller deletes it
+    // -- freeze:       builds the same snapshot in memory and returns it, for a read-mostly phase where lookups and...
+    //                  ...prefix scans over one compact block beat chasing "link" / "next" pointers across the heap.
+    //                  The tree itself is left untouched (it can be deleted to give its memory back). The caller...
+    //                  ...deletes the snapshot; NULL is returned if the tree is too large for the format, as for "save"
+    // -- exportSuccinct: builds a "SuccinctRadixIndex" of the tree, a few bits per node plus 2 bits per label base,...
+    //                  ...for archival indexes too large to keep as nodes; returns NULL if any string holds anything...
+    //                  ...but A, C, G, T. The tree is left untouched and the caller deletes the index
+    //
+    bool save(const char* path);
+    static RadixSnapshot* mapSnapshot(const char* path);
+    RadixSnapshot* freeze();
+    SuccinctRadixIndex* exportSuccinct();
+
+    // Printing functions, take the address of the file to print to (nothing is printed to a file if it is empty) and a...
+    // ...console echo option. Output is built in large blocks (see "ExportBuffer") rather than one character at a time
     void sortAndPrintStrings(const char* address, bool echo = false);
     void printNodes(const char* address, bool echo = false);
     void printTree(const char* address, bool echo = false);
@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+using namespace std;
+
+#include "RadixTree.h"
+#include "DNARadixTree.h"
+
+// Micro-benchmark driver for "RadixTree", built as a program of its own (see README.md)
+//
+// For every combination of segment count and segment length range, a fresh tree is built and every public operation...
+// ...is measured on its own, with segment generation done beforehand so that only the operation itself is timed:
+//
+// -- Per-string operations (addString, searchString hit / miss, deleteString) are timed one call at a time, giving...
+//    ...throughput (ops/s, mean ns/op) and latency percentiles. The clock itself adds a few tens of nanoseconds...
+//    ...to every sample, which matters for the fastest operations only.
+// -- Whole-tree operations (searchMany over all hits, countStrings, fetchStrings, sortAndPrintStrings, copy,...
+//    ...destruction) are timed as one call, reported as total time and ns per string.
+//
+// The per-string operations are then timed again on "DNARadixTree" (rows starting with "DNA"), the packed DNA-only...
+// ...tree with children dispatched by base, which is a type of its own: "RadixTree" keeps its byte labels and sibling...
+// ...lists, so these rows are what tells the two representations apart.
+//
+// Bulk building with "addStringsParallel" is timed right after "addString", once per thread count of "--threads",...
+// ...each time into a fresh tree, and reported as total time and ns per string (rows "addStringsParallel/N").
+//
+// Memory per string is taken from the tree's own "memoryReport" once every segment has been added, allocator overhead...
+// ...included, for heap-backed and arena-backed ("--arena") trees alike.
+//
+// Usage: RadixTreeBenchmark [--arena] [--counts 1000,10000,100000] [--lengths 10-100,100-1000] [--threads 1,2,4]...
+//        ...[--seed 1337]
+//
+
+// ---------------------------------------------------------------------------------------------
+// This function generates "num" random DNA segments of length between "min" and "max"
+//
+char** generateSegments(int num, int min, int max);
+// Returns a "malloc"-ed array of "malloc"-ed segments
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// This function prints one result line for a per-string operation, given the latency of every...
+// ...call in "samples" (in nanoseconds, sorted in place) and the total time in "totalNs"
+//
+void reportSamples(const char* name, long long* samples, int num, long long totalNs);
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// This function prints one result line for a whole-tree operation that took "totalNs" nanoseconds
+//
+void reportWhole(const char* name, long long totalNs, int strings);
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// The benchmark itself, for "num" segments of length between "min" and "max", bulk building...
+// ...with every thread count of the comma-separated list "threads"
+//
+void runBenchmark(bool arena, int num, int min, int max, const char* threads);
+// ---------------------------------------------------------------------------------------------
+
+// Nanoseconds elapsed since "start"
+static long long elapsedNs(chrono::steady_clock::time_point start) {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+
+    bool arena = false;
+    const char* counts = "1000,10000,100000";
+    const char* lengths = "10-100,100-1000";
+    const char* threads = "1,2,4";
+    unsigned int seed = 1337;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--arena")) arena = true;
+        else if (!strcmp(argv[i], "--counts") && i + 1 < argc) counts = argv[++i];
+        else if (!strcmp(argv[i], "--lengths") && i + 1 < argc) lengths = argv[++i];
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = argv[++i];
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = (unsigned int) atoi(argv[++i]);
+        else {
+            cout << "Usage: " << argv[0] << " [--arena] [--counts 1000,10000] [--lengths 10-100,100-1000] [--threads 1,2,4] [--seed 1337]\n";
+            return 1;
+        }
+    }
+
+    srand(seed);
+
+    cout << (arena ? "Arena-backed" : "Heap-backed") << " Radix Tree benchmark\n\n";
+    cout << left << setw(22) << "operation" << right << setw(14) << "ops/s" << setw(12) << "ns/op"
+         << setw(10) << "p50" << setw(10) << "p90" << setw(10) << "p99" << setw(10) << "p99.9" << "\n";
+
+    // Sweep every count with every length range, both lists being comma-separated
+
+    for (const char* c = counts; *c;) {
+
+        int num = (int) strtol(c, (char**) &c, 10);
+        if (*c == ',') c++;
+
+        for (const char* l = lengths; *l;) {
+
+            int min = (int) strtol(l, (char**) &l, 10), max = min;
+            if (*l == '-') max = (int) strtol(l + 1, (char**) &l, 10);
+            if (*l == ',') l++;
+
+            runBenchmark(arena, num, min, max, threads);
+
+        }
+
+    }
+
+    return 0;
+
+}
+
+char** generateSegments(int num, int min, int max) {
+
+    const char DNA[4] = { 'A', 'C', 'G', 'T' };
+    char** segments = (char**) malloc(num * sizeof(char*));
+
+    for (int i = 0; i < num; i++) {
+
+        int len = (max - min) ? (min + rand() % (max - min + 1)) : min;
+
+        segments[i] = (char*) malloc(len + 1);
+        for (int j = 0; j < len; j++) segments[i][j] = DNA[rand() % 4];
+        segments[i][len] = 0;
+
+    }
+
+    return segments;
+
+}
+
+void reportSamples(const char* name, long long* samples, int num, long long totalNs) {
+
+    sort(samples, samples + num);
+
+    // Nearest-rank percentiles
+    long long p50 = samples[(int) (num * 0.5)], p90 = samples[(int) (num * 0.9)];
+    long long p99 = samples[(int) (num * 0.99)], p999 = samples[(int) (num * 0.999)];
+
+    cout << left << setw(22) << name << right << fixed << setprecision(0)
+         << setw(14) << (num * 1e9 / totalNs) << setw(12) << ((double) totalNs / num)
+         << setw(10) << p50 << setw(10) << p90 << setw(10) << p99 << setw(10) << p999 << "\n";
+
+}
+
+void reportWhole(const char* name, long long totalNs, int strings) {
+
+    cout << left << setw(22) << name << right << fixed << setprecision(3)
+         << setw(14) << (totalNs / 1e6) << " ms" << setprecision(1)
+         << setw(9) << (strings ? (double) totalNs / strings : 0.0) << " ns/string\n";
+
+}
+
+void runBenchmark(bool arena, int num, int min, int max, const char* threads) {
+
+    cout << "\n--- " << num << " segments of length " << min << "-" << max << " ---\n";
+
+    char** segments = generateSegments(num, min, max);
+    char** missing = generateSegments(num, min, max);
+
+    // Lengths are known up front, as they would be for segments read from a file
+    int* lengths = (int*) malloc(num * sizeof(int));
+    for (int i = 0; i < num; i++) lengths[i] = (int) strlen(segments[i]);
+
+    long long* samples = (long long*) malloc(num * sizeof(long long));
+
+    // addString
+
+    RadixTree* rt = new RadixTree(arena);
+
+    chrono::steady_clock::time_point all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        rt->addString(segments[i], lengths[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("addString", samples, num, elapsedNs(all));
+
+    int strings = rt->countStrings();
+    long long treeBytes = rt->memoryReport().totalBytes();
+
+    // addStringsParallel, the same segments into a fresh tree for every thread count
+
+    for (const char* t = threads; *t;) {
+
+        int n = (int) strtol(t, (char**) &t, 10);
+        if (*t == ',') t++;
+
+        char name[32];
+        snprintf(name, sizeof(name), "addStringsParallel/%d", n);
+
+        RadixTree* bulk = new RadixTree(arena);
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        bulk->addStringsParallel(segments, segments + num, n);
+        reportWhole(name, elapsedNs(start), num);
+
+        delete bulk;
+
+    }
+
+    // searchString, every segment of the tree, then segments that are (almost surely) not in it
+
+    int hits = 0;
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        hits += rt->searchString(segments[i], lengths[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("searchString (hit)", samples, num, elapsedNs(all));
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        hits += rt->searchString(missing[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("searchString (miss)", samples, num, elapsedNs(all));
+
+    // searchMany, the same hits as one batch (no per-call latency there, only the time of the whole batch)
+
+    bool* found = (bool*) malloc(num * sizeof(bool));
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    rt->searchMany(segments, num, found);
+    reportWhole("searchMany (hit)", elapsedNs(start), num);
+
+    for (int i = 0; i < num; i++) hits += found[i];
+    free(found);
+
+    // Whole-tree operations
+
+    start = chrono::steady_clock::now();
+    int counted = rt->countStrings();
+    reportWhole("countStrings", elapsedNs(start), strings);
+
+    start = chrono::steady_clock::now();
+    char** fetched = rt->fetchStrings();
+    reportWhole("fetchStrings", elapsedNs(start), strings);
+
+    for (int i = 0; i < strings; i++) free(fetched[i]);
+    free(fetched);
+
+    start = chrono::steady_clock::now();
+    rt->sortAndPrintStrings("RadixTreeBenchmark.txt");
+    reportWhole("sortAndPrintStrings", elapsedNs(start), strings);
+    remove("RadixTreeBenchmark.txt");
+
+    start = chrono::steady_clock::now();
+    RadixTree* copy = new RadixTree(rt);
+    reportWhole("copy", elapsedNs(start), strings);
+
+    start = chrono::steady_clock::now();
+    delete copy;
+    reportWhole("destruction", elapsedNs(start), strings);
+
+    // deleteString, the segments of the tree in a shuffled order (a segment generated twice is only deleted once)
+
+    for (int i = num - 1; i > 0; i--) swap(segments[i], segments[rand() % (i + 1)]);
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        rt->deleteString(segments[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("deleteString", samples, num, elapsedNs(all));
+
+    delete rt;
+
+    // The same per-string operations on "DNARadixTree" (segments from the shuffled order, as for deleteString)
+
+    DNARadixTree* dt = new DNARadixTree();
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        dt->addString(segments[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("DNA addString", samples, num, elapsedNs(all));
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        hits += dt->searchString(segments[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("DNA search (hit)", samples, num, elapsedNs(all));
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        hits += dt->searchString(missing[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("DNA search (miss)", samples, num, elapsedNs(all));
+
+    all = chrono::steady_clock::now();
+    for (int i = 0; i < num; i++) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        dt->deleteString(segments[i]);
+        samples[i] = elapsedNs(start);
+    }
+    reportSamples("DNA deleteString", samples, num, elapsedNs(all));
+
+    delete dt;
+
+    cout << "memory: " << fixed << setprecision(1) << (double) treeBytes / strings << " bytes/string (" << strings << " strings, " << counted << " counted, " << hits << " hits)\n";
+
+    for (int i = 0; i < num; i++) { free(segments[i]); free(missing[i]); }
+    free(segments);
+    free(missing);
+    free(lengths);
+    free(samples);
+
+}
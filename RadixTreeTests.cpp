@@ -0,0 +1,642 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+using namespace std;
+
+#include "RadixTree.h"
+#include "AlphabetRadixTree.h"
+#include "SequenceReader.h"
+#include "SuccinctRadixIndex.h"
+#include "ShardedRadixTree.h"
+#include "RadixMap.h"
+#include "RadixSnapshot.h"
+
+// Regression tests, built as a program of their own (see README.md)
+//
+// Every test prints what it checks when it fails, and the program exits with a non-zero status if any of them did.
+// Files a test needs are written next to the program and removed once it is done with them.
+//
+// Usage: RadixTreeTests
+//
+
+// Number of failed checks so far
+static int failures = 0;
+
+// Records a failed check, "what" saying what was expected
+static void check(bool ok, const char* test, const char* what) {
+    if (ok) return;
+    printf("FAILED %s: %s\n", test, what);
+    failures++;
+}
+
+// Writes "text" to the file at "path"
+static void writeFile(const char* path, const char* text) {
+    FILE* file = fopen(path, "wb");
+    fputs(text, file);
+    fclose(file);
+}
+
+// Reads the whole file at "path" into a "malloc"-ed block, its size going to "size"
+static char* readFile(const char* path, long& size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return 0;
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* data = (char*) malloc(size ? size : 1);
+    if (fread(data, 1, size, file) != (size_t) size) size = 0;
+    fclose(file);
+    return data;
+}
+
+// Writes the "size" bytes at "data" to the file at "path"
+static void writeFile(const char* path, const char* data, long size) {
+    FILE* file = fopen(path, "wb");
+    fwrite(data, 1, size, file);
+    fclose(file);
+}
+
+// ---------------------------------------------------------------------------------------------
+// FASTQ records with an empty read: the empty sequence and quality lines are still two of the...
+// ...record's four lines, so the records after it must be read as usual (the empty read itself...
+// ...is rejected, having no sequence). Blank lines between records are skipped, and a tiny read...
+// ...chunk makes records straddle refills of the buffer.
+//
+void testFastqEmptyRead();
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// Differential test of "AlphabetRadixTree" against "RadixTree": the same random additions and...
+// ...deletions of strings made of "symbols" (1 to "maxLen" of them) go to both trees, which must...
+// ...agree on every search and on the string count. At the end the tree must also have exactly...
+// ...the nodes and label bytes of a fresh tree built from the strings left, a radix tree being...
+// ...the same whatever order its strings came in, which checks the live node counter
+//
+template <typename Tree>
+void testAgainstRadixTree(const char* test, const char* symbols, int maxLen, int ops);
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// "sortRadixTree" on keys holding bytes above 0x7F: siblings must stay in unsigned byte order,...
+// ...which searches rely on to stop early, so every key must still be found after sorting and...
+// ...the iteration must still be in strcmp (unsigned) order
+//
+void testSortHighBytes();
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// Corrupted "SuccinctRadixIndex" files: every single-bit flip of a saved index is loaded. Flips...
+// ...in the header or in the LOUDS bits must be rejected, as must a truncated file; any other...
+// ...flip (a label base, or a bit past the end of a vector) may load, but the index must then...
+// ...still be consistent, scanning and counting as many strings as it claims to hold
+//
+void testSuccinctCorruption();
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// "addStringsParallel" against "addString": the same strings, some shorter than "k" and some...
+// ...with other characters than A, C, G, T in their first "k" (which are added one by one after...
+// ...the buckets are grafted), must give the same strings in the same order and the same number...
+// ...of nodes, whatever the number of threads and "k"
+//
+void testParallelAgainstSerial();
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// "ShardedRadixTree" against a single "RadixTree": the same additions and deletions of segments,...
+// ...mixing regular ones with ones that go to the overflow shard (shorter than "k" bases, or with...
+// ...an N in their first "k" characters), must leave both with the same strings, counted alike and...
+// ...iterated in the same order, the overflow shard being merged in between the regular ones
+//
+void testShardedAgainstRadixTree(int k);
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// "RadixMap" against "std::map": a random mix of upsert, increment, erase and get on short keys...
+// ...over two letters, so that keys are often prefixes of each other and every operation splits...
+// ...or joins nodes above some leaf. Every value must stay with its key through all of it, "forEach"...
+// ...visiting exactly the keys and values of the reference, in order
+//
+void testRadixMapAgainstMap();
+// ---------------------------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------------------------
+// "RadixSnapshot" round trip: a tree saved to a file and mapped back, and the same tree frozen...
+// ...in memory, must both find every string of the tree and none of the misses, count as many...
+// ...strings under every short prefix and iterate the same strings in the same order. A truncated...
+// ...file, and files with a wrong version, byte order marker, child index or last label, must all...
+// ...be rejected
+//
+void testSnapshotRoundTrip();
+// ---------------------------------------------------------------------------------------------
+
+int main() {
+
+    testFastqEmptyRead();
+
+    srand(1337);
+
+    testAgainstRadixTree<DNARadixTree>("testDNAAgainstRadixTree (short)", "ACGT", 8, 100000);
+    testAgainstRadixTree<DNARadixTree>("testDNAAgainstRadixTree (long)", "ACGT", 150, 20000);
+    testAgainstRadixTree<IUPACRadixTree>("testIUPACAgainstRadixTree", "-ABCDGHKMNRSTVWY", 12, 50000);
+    testAgainstRadixTree<ProteinRadixTree>("testProteinAgainstRadixTree", "ACDEFGHIKLMNPQRSTVWY", 30, 50000);
+    testAgainstRadixTree<ByteRadixTree>("testBytesAgainstRadixTree", "AC\x01\x7F\x80\xFF", 40, 50000);
+
+    testSortHighBytes();
+    testSuccinctCorruption();
+    testParallelAgainstSerial();
+
+    for (int k = 0; k <= 3; k++) testShardedAgainstRadixTree(k);
+
+    testRadixMapAgainstMap();
+    testSnapshotRoundTrip();
+
+    if (failures) printf("%d check(s) failed\n", failures);
+    else printf("All tests passed\n");
+
+    return failures ? 1 : 0;
+
+}
+
+void testFastqEmptyRead() {
+
+    const char* test = "testFastqEmptyRead";
+    const char* path = "RadixTreeTests.fq";
+
+    writeFile(path, "@r1\nACGT\n+\nIIII\n"
+                    "@r2\n\n+\n\n"
+                    "@r3\nggcc\n+\nIIII\n"
+                    "\n"
+                    "@r4\r\nTTAACG\r\n+\r\nIIIIII\r\n"
+                    "@r5\n\n+\n\n");
+
+    for (size_t chunk = 4; chunk <= 1024; chunk *= 16) {
+
+        SequenceReader reader(path, chunk);
+        check(reader.isOpen(), test, "the file opens");
+
+        RadixTree tree;
+        long long added = reader.load(tree);
+
+        check(added == 3, test, "three reads are handed to the tree");
+        check(reader.records() == 3 && reader.rejected() == 2, test, "three records accepted, the two empty reads rejected");
+        check(tree.countStrings() == 3, test, "the tree holds three strings");
+        check(tree.searchString("ACGT") && tree.searchString("GGCC") && tree.searchString("TTAACG"), test,
+              "the reads after the empty one are found (uppercased)");
+        check(!tree.searchString("IIII") && !tree.searchString("+"), test, "no quality or separator line is read");
+
+    }
+
+    remove(path);
+
+}
+
+template <typename Tree>
+void testAgainstRadixTree(const char* test, const char* symbols, int maxLen, int ops) {
+
+    int alphabet = (int) strlen(symbols), before = failures;
+    char* str = (char*) malloc(maxLen + 1);
+
+    Tree* tree = new Tree();
+    RadixTree reference;
+
+    // The first mismatch is enough, later ones would only be consequences of it
+    for (int i = 0; i < ops && failures == before; i++) {
+
+        int len = 1 + rand() % maxLen;
+        for (int j = 0; j < len; j++) str[j] = symbols[rand() % alphabet];
+        str[len] = 0;
+
+        // Two additions for every deletion, so that the trees keep growing while nodes keep being joined
+
+        int op = rand() % 3;
+
+        if (op < 2) {
+            check(tree->addString(str) == !reference.searchString(str), test, "addString only adds absent strings");
+            reference.addString(str);
+        } else {
+            tree->deleteString(str);
+            reference.deleteString(str);
+        }
+
+        check(tree->searchString(str) == reference.searchString(str), test, "both trees agree on the string just used");
+        check(tree->countStrings() == reference.countStrings(), test, "both trees hold as many strings");
+
+    }
+
+    // Every string left in the reference is in the tree (the counts being equal, the tree holds nothing else)
+
+    for (RadixTree::iterator it = reference.begin(); it != reference.end(); ++it)
+        check(tree->searchString(*it), test, "every string of the reference is found");
+
+    Tree* fresh = new Tree();
+    for (RadixTree::iterator it = reference.begin(); it != reference.end(); ++it) fresh->addString(*it);
+
+    check(tree->countNodes() == fresh->countNodes(), test, "as many nodes as a tree built from scratch");
+    check(tree->labelBytes() == fresh->labelBytes(), test, "as many label bytes as a tree built from scratch");
+
+    delete fresh;
+    delete tree;
+    free(str);
+
+}
+
+void testSortHighBytes() {
+
+    const char* test = "testSortHighBytes";
+    const char* symbols = "A\x01\x7F\x80\xC3\xFF";
+    const int count = 2000, maxLen = 12;
+
+    char** keys = (char**) malloc(count * sizeof(char*));
+    RadixTree tree;
+
+    for (int i = 0; i < count; i++) {
+        int len = 1 + rand() % maxLen;
+        keys[i] = (char*) malloc(len + 1);
+        for (int j = 0; j < len; j++) keys[i][j] = symbols[rand() % 6];
+        keys[i][len] = 0;
+        tree.addString(keys[i]);
+    }
+
+    tree.sortRadixTree();
+
+    bool found = true;
+    for (int i = 0; i < count; i++) found = found && tree.searchString(keys[i]);
+    check(found, test, "every key is found after sorting");
+
+    bool ordered = true;
+    int seen = 0;
+    char previous[maxLen + 1] = "";
+    for (RadixTree::iterator it = tree.begin(); it != tree.end(); ++it, seen++) {
+        if (seen && strcmp(previous, *it) >= 0) ordered = false;
+        strcpy(previous, *it);
+    }
+    check(ordered, test, "iteration is in unsigned byte order after sorting");
+    check(seen == tree.countStrings(), test, "iteration visits every string");
+
+    for (int i = 0; i < count; i++) free(keys[i]);
+    free(keys);
+
+}
+
+void testSuccinctCorruption() {
+
+    const char* test = "testSuccinctCorruption";
+    const char* path = "RadixTreeTests.idx";
+
+    RadixTree tree;
+    const char* strings[] = {"ACGT", "ACGTT", "ACGA", "GATTACA", "GAT", "TTT", "C", "CCCCGGGGAAAATTTT", "ACG"};
+    int count = (int) (sizeof(strings) / sizeof(strings[0]));
+    for (int i = 0; i < count; i++) tree.addString(strings[i]);
+
+    SuccinctRadixIndex* index = tree.exportSuccinct();
+    check(index && index->save(path), test, "the index is saved");
+    long long nodes = index ? index->countNodes() : 0;
+    delete index;
+
+    long size = 0;
+    char* data = readFile(path, size);
+    check(data && size > 0, test, "the saved index is read back");
+
+    index = SuccinctRadixIndex::load(path);
+    check(index && index->countStrings() == count, test, "the intact index loads");
+    delete index;
+
+    // Header: magic (8), version (4), node and string counts (8 each), then the LOUDS size (8) and its 2n + 1 bits
+
+    const long strictBits = (28 + 8) * 8 + 2 * nodes + 1;
+
+    bool strict = true, consistent = true;
+
+    for (long bit = 0; bit < 8 * size; bit++) {
+
+        data[bit / 8] ^= (char) (1 << (bit % 8));
+        writeFile(path, data, size);
+        data[bit / 8] ^= (char) (1 << (bit % 8));
+
+        index = SuccinctRadixIndex::load(path);
+
+        if (!index) continue;
+
+        if (bit < strictBits) strict = false;
+
+        long long held = index->countStrings();
+        if (index->countWithPrefix("") != held || index->forEachWithPrefix("", 0) != held) consistent = false;
+        for (int i = 0; i < count; i++) index->searchString(strings[i]);
+
+        delete index;
+
+    }
+
+    check(strict, test, "every flip in the header or the LOUDS bits is rejected");
+    check(consistent, test, "an index loaded despite a flip still counts what it scans");
+
+    writeFile(path, data, size - 5);
+    index = SuccinctRadixIndex::load(path);
+    check(!index, test, "a truncated index is rejected");
+    delete index;
+
+    free(data);
+    remove(path);
+
+}
+
+void testParallelAgainstSerial() {
+
+    const char* test = "testParallelAgainstSerial";
+    const char* symbols = "ACGTACGTACGTACGTNn-";
+    const int count = 20000, maxLen = 24;
+
+    char** strs = (char**) malloc(count * sizeof(char*));
+
+    for (int i = 0; i < count; i++) {
+
+        // Mostly A, C, G, T, with now and then a character that keeps the string out of the buckets
+        int len = 1 + rand() % maxLen;
+        strs[i] = (char*) malloc(len + 1);
+        for (int j = 0; j < len; j++) strs[i][j] = symbols[rand() % (rand() % 8 ? 16 : 19)];
+        strs[i][len] = 0;
+
+    }
+
+    RadixTree serial;
+    for (int i = 0; i < count; i++) serial.addString(strs[i]);
+
+    const int threads[] = {1, 2, 4, 7};
+    const int ks[] = {1, 4, 6};
+
+    for (int t = 0; t < 4; t++) {
+        for (int k = 0; k < 3; k++) {
+
+            RadixTree parallel;
+            parallel.addStringsParallel(strs, strs + count, threads[t], ks[k]);
+
+            check(parallel.countStrings() == serial.countStrings(), test, "as many strings as added one by one");
+            check(parallel.countNodes() == serial.countNodes(), test, "as many nodes as added one by one");
+
+            RadixTree::iterator a = parallel.begin(), b = serial.begin();
+            while (a != parallel.end() && b != serial.end() && !strcmp(*a, *b)) { ++a; ++b; }
+            check(a == parallel.end() && b == serial.end(), test, "the same strings in the same order as added one by one");
+
+        }
+    }
+
+    for (int i = 0; i < count; i++) free(strs[i]);
+    free(strs);
+
+}
+
+void testShardedAgainstRadixTree(int k) {
+
+    const char* test = "testShardedAgainstRadixTree";
+    const int ops = 20000, maxLen = 10;
+
+    char str[maxLen + 1];
+    ShardedRadixTree sharded(k);
+    RadixTree reference;
+
+    int overflowed = 0;
+
+    for (int i = 0; i < ops; i++) {
+
+        // Lengths from 1 up, so that some are shorter than "k", and now and then an N among A, C, G, T
+        int len = 1 + rand() % maxLen;
+        for (int j = 0; j < len; j++) str[j] = rand() % 16 ? "ACGT"[rand() % 4] : 'N';
+        str[len] = 0;
+
+        if (len < k || strcspn(str, "N") < (size_t) k) overflowed++;
+
+        if (rand() % 3 < 2) {
+            sharded.addString(str);
+            reference.addString(str);
+        } else {
+            sharded.deleteString(str);
+            reference.deleteString(str);
+        }
+
+        check(sharded.searchString(str) == reference.searchString(str), test, "both agree on the segment just used");
+
+    }
+
+    check(k == 0 || overflowed > 0, test, "some segments go to the overflow shard");
+    check(sharded.countStrings() == reference.countStrings(), test, "as many strings as a single tree");
+
+    ShardedRadixTree::iterator a = sharded.begin();
+    RadixTree::iterator b = reference.begin();
+    while (a != sharded.end() && b != reference.end() && !strcmp(*a, *b) && a.length() == b.length()) { ++a; ++b; }
+    check(a == sharded.end() && b == reference.end(), test, "the same strings in the same order as a single tree");
+
+}
+
+// Where "forEach" is in the reference map, and whether every string and value so far matched it
+struct MapWalk {
+    map<string, long long>::const_iterator at, end;
+    bool same;
+};
+
+static bool compareEntry(const char* str, int len, long long& value, void* context) {
+    MapWalk* walk = (MapWalk*) context;
+    walk->same = walk->same && walk->at != walk->end && walk->at->first == string(str, len) && walk->at->second == value;
+    if (walk->at != walk->end) ++walk->at;
+    return true;
+}
+
+void testRadixMapAgainstMap() {
+
+    const char* test = "testRadixMapAgainstMap";
+    const int ops = 100000, maxLen = 7;
+
+    RadixMap<long long> radixMap;
+    map<string, long long> reference;
+    char str[maxLen + 1];
+    int before = failures;
+
+    for (int i = 0; i < ops && failures == before; i++) {
+
+        int len = rand() % (maxLen + 1);
+        for (int j = 0; j < len; j++) str[j] = "AB"[rand() % 2];
+        str[len] = 0;
+
+        // Values are all different, so that a value ending up under another key is noticed
+
+        long long* value;
+        bool present = reference.count(str) > 0;
+
+        switch (rand() % 4) {
+            case 0:
+                check(radixMap.upsert(str, i) == !present, test, "upsert adds absent keys only");
+                reference[str] = i;
+                break;
+            case 1:
+                check(radixMap.increment(str, i) == (reference[str] += i), test, "increment returns the new value");
+                break;
+            case 2:
+                check(radixMap.erase(str) == present, test, "erase removes present keys only");
+                reference.erase(str);
+                break;
+            default:
+                value = radixMap.get(str);
+                check(present ? value && *value == reference[str] : !value, test, "get finds the value of the key");
+        }
+
+        check(radixMap.countStrings() == (int) reference.size(), test, "as many keys as the reference");
+
+    }
+
+    MapWalk walk = { reference.begin(), reference.end(), true };
+    int visited = radixMap.forEach(compareEntry, &walk);
+
+    check(walk.same && walk.at == walk.end && visited == (int) reference.size(), test,
+          "forEach visits the keys and values of the reference, in order");
+
+}
+
+// Compares "snapshot" with "tree", the strings in "strs" being in the tree and the ones in "misses" (almost surely) not
+static void compareSnapshot(const char* test, RadixSnapshot* snapshot, RadixTree& tree, char** strs, char** misses,
+                            int count, const char* symbols) {
+
+    check(snapshot->countStrings() == tree.countStrings(), test, "as many strings as the tree");
+
+    bool hits = true, same = true;
+    for (int i = 0; i < count; i++) {
+        hits = hits && snapshot->searchString(strs[i]);
+        same = same && snapshot->searchString(misses[i]) == tree.searchString(misses[i]);
+    }
+    check(hits, test, "every string of the tree is found");
+    check(same, test, "the misses are missed as in the tree");
+
+    // Every prefix of up to two symbols, the empty one included
+
+    int alphabet = (int) strlen(symbols);
+    char prefix[3];
+    bool counts = true;
+
+    for (int i = -1; i < alphabet; i++) {
+        for (int j = -1; j < alphabet; j++) {
+            if (i < 0 && j >= 0) continue;
+            prefix[0] = i < 0 ? 0 : symbols[i];
+            prefix[1] = j < 0 ? 0 : symbols[j];
+            prefix[2] = 0;
+            counts = counts && snapshot->countWithPrefix(prefix) == tree.countWithPrefix(prefix);
+        }
+    }
+    check(counts, test, "as many strings under every short prefix as the tree");
+
+    RadixSnapshot::iterator a = snapshot->begin();
+    RadixTree::iterator b = tree.begin();
+    while (a != snapshot->end() && b != tree.end() && !strcmp(*a, *b)) { ++a; ++b; }
+    check(a == snapshot->end() && b == tree.end(), test, "the same strings in the same order as the tree");
+
+}
+
+void testSnapshotRoundTrip() {
+
+    const char* test = "testSnapshotRoundTrip";
+    const char* path = "RadixTreeTests.snap";
+    const char* damaged = "RadixTreeTests.bad";
+    const char* symbols = "ACGT\xC3";
+    const int count = 5000, maxLen = 20;
+
+    char** strs = (char**) malloc(count * sizeof(char*));
+    char** misses = (char**) malloc(count * sizeof(char*));
+
+    RadixTree tree;
+
+    for (int i = 0; i < count; i++) {
+
+        int len = 1 + rand() % maxLen;
+        strs[i] = (char*) malloc(len + 1);
+        misses[i] = (char*) malloc(len + 2);
+
+        for (int j = 0; j < len; j++) strs[i][j] = symbols[rand() % 5];
+        strs[i][len] = 0;
+        tree.addString(strs[i]);
+
+        // Either a string of its own or one of the tree's strings made one symbol longer
+        if (rand() % 2) for (int j = 0; j < len; j++) misses[i][j] = symbols[rand() % 5];
+        else memcpy(misses[i], strs[i], len);
+        misses[i][len] = symbols[rand() % 5];
+        misses[i][len + 1] = 0;
+
+    }
+
+    check(tree.save(path), test, "the tree is saved");
+
+    RadixSnapshot* snapshot = RadixTree::mapSnapshot(path);
+    check(snapshot != 0, test, "the saved tree is mapped");
+    if (snapshot) compareSnapshot(test, snapshot, tree, strs, misses, count, symbols);
+    delete snapshot;
+
+    snapshot = tree.freeze();
+    check(snapshot != 0, test, "the tree is frozen");
+    if (snapshot) compareSnapshot(test, snapshot, tree, strs, misses, count, symbols);
+    delete snapshot;
+
+    // Damaged copies of the file, none of which may be mapped
+
+    long size = 0;
+    char* data = readFile(path, size);
+    check(data && size > (long) sizeof(RadixSnapshot::Header), test, "the saved tree is read back");
+
+    RadixSnapshot::Header* header = (RadixSnapshot::Header*) data;
+    RadixSnapshot::Record* records = (RadixSnapshot::Record*) (data + sizeof(RadixSnapshot::Header));
+
+    long cuts[] = {size - 1, size / 2, (long) sizeof(RadixSnapshot::Header), 4};
+    for (int i = 0; i < 4; i++) {
+        writeFile(damaged, data, cuts[i]);
+        snapshot = RadixTree::mapSnapshot(damaged);
+        check(!snapshot, test, "a truncated file is rejected");
+        delete snapshot;
+    }
+
+    header->version++;
+    writeFile(damaged, data, size);
+    header->version--;
+    snapshot = RadixTree::mapSnapshot(damaged);
+    check(!snapshot, test, "a file of another version is rejected");
+    delete snapshot;
+
+    header->byteOrder = 0x04030201;
+    writeFile(damaged, data, size);
+    header->byteOrder = RadixSnapshot::ORDER_MARK;
+    snapshot = RadixTree::mapSnapshot(damaged);
+    check(!snapshot, test, "a file of the other byte order is rejected");
+    delete snapshot;
+
+    records[1].firstChild += header->nodeCount;
+    writeFile(damaged, data, size);
+    records[1].firstChild -= header->nodeCount;
+    snapshot = RadixTree::mapSnapshot(damaged);
+    check(!snapshot, test, "a file with a child index out of range is rejected");
+    delete snapshot;
+
+    // The labels end the file, the last one being a leaf's
+    data[size - 1] = 'A';
+    writeFile(damaged, data, size);
+    data[size - 1] = 0;
+    snapshot = RadixTree::mapSnapshot(damaged);
+    check(!snapshot, test, "a file whose last label has lost its null terminator is rejected");
+    delete snapshot;
+
+    writeFile(damaged, data, size);
+    snapshot = RadixTree::mapSnapshot(damaged);
+    check(snapshot && snapshot->countStrings() == tree.countStrings(), test, "the undamaged copy is mapped");
+    delete snapshot;
+
+    for (int i = 0; i < count; i++) { free(strs[i]); free(misses[i]); }
+    free(strs);
+    free(misses);
+    free(data);
+    remove(path);
+    remove(damaged);
+
+}
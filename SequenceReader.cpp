@@ -0,0 +1,286 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstring>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+using namespace std;
+
+#include "SequenceReader.h"
+#include "RadixTree.h"
+
+SequenceReader::SequenceReader(const char* path, size_t chunkBytes, size_t batch)
+    : file(fopen(path, "rb")), buffer(0), bufferSize(chunkBytes), begin(0), end(0), eof(false), fastq(false),
+      detected(false), phase(0), inRecord(false), recordStart(0), recordValid(true), batchBytes(batch), accepted(0),
+      rejectedCount(0) {
+
+    if (!file) return;
+
+    buffer = (char*) malloc(bufferSize);
+
+    // The reads are already large, the C library's own buffering would only add a copy
+    setvbuf(file, 0, _IONBF, 0);
+
+}
+
+SequenceReader::~SequenceReader() {
+    if (file) fclose(file);
+    free(buffer);
+}
+
+bool SequenceReader::copyACGT(const char* src, char* dst, size_t n) {
+
+    size_t i = 0;
+
+#ifdef __SSE2__
+    // Clearing bit 5 uppercases a letter, and only 'a' and 'A' (resp. c, g, t) end up equal to 'A' (resp. C, G, T)...
+    // ...that way, so comparing the result against the four letters validates and uppercases 16 characters at once
+
+    const __m128i caseMask = _mm_set1_epi8((char) 0xDF);
+    const __m128i a = _mm_set1_epi8('A'), c = _mm_set1_epi8('C'), g = _mm_set1_epi8('G'), t = _mm_set1_epi8('T');
+
+    for (; i + 16 <= n; i += 16) {
+
+        __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*) (src + i)), caseMask);
+        __m128i ok = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, a), _mm_cmpeq_epi8(v, c)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(v, g), _mm_cmpeq_epi8(v, t)));
+
+        if (_mm_movemask_epi8(ok) != 0xFFFF) return false;
+        _mm_storeu_si128((__m128i*) (dst + i), v);
+
+    }
+#endif
+
+    // Whatever is left (or everything, without SSE2), one character at a time
+
+    for (; i < n; i++) {
+        char u = (char) (src[i] & 0xDF);
+        if (u != 'A' && u != 'C' && u != 'G' && u != 'T') return false;
+        dst[i] = u;
+    }
+
+    return true;
+
+}
+
+void SequenceReader::fill() {
+
+    // Move the unscanned bytes to the front, and make room if they already fill the whole buffer
+
+    memmove(buffer, buffer + begin, end - begin);
+    end -= begin;
+    begin = 0;
+
+    if (end == bufferSize) {
+        bufferSize *= 2;
+        buffer = (char*) realloc(buffer, bufferSize);
+    }
+
+    size_t got = fread(buffer + end, 1, bufferSize - end, file);
+    if (got == 0) eof = true;
+    end += got;
+
+}
+
+bool SequenceReader::nextLine(const char*& line, size_t& n) {
+
+    for (;;) {
+
+        const char* nl = (const char*) memchr(buffer + begin, '\n', end - begin);
+
+        if (nl || (eof && begin < end)) {
+
+            // At the end of the file, the last line may have no "\n"
+            size_t stop = nl ? (size_t) (nl - buffer) : end;
+
+            line = buffer + begin;
+            n = stop - begin;
+            begin = nl ? stop + 1 : end;
+
+            if (n && line[n - 1] == '\r') n--;
+            return true;
+
+        }
+
+        if (eof) return false;
+        fill();
+
+    }
+
+}
+
+void SequenceReader::startRecord(Batch& b) {
+    recordStart = b.used;
+    recordValid = true;
+}
+
+void SequenceReader::appendLine(Batch& b, const char* line, size_t n) {
+
+    // Once a line is invalid the whole record will be dropped, no need to copy anything else
+    if (!recordValid) return;
+
+    if (b.used + n + 1 > b.capacity) {
+        b.capacity = 2 * (b.used + n + 1) > batchBytes ? 2 * (b.used + n + 1) : batchBytes;
+        b.data = (char*) realloc(b.data, b.capacity);
+    }
+
+    recordValid = copyACGT(line, b.data + b.used, n);
+    b.used += n;
+
+}
+
+void SequenceReader::finishRecord(Batch& b) {
+
+    size_t n = b.used - recordStart;
+
+    if (!recordValid || n == 0) {
+        b.used = recordStart;
+        rejectedCount++;
+        return;
+    }
+
+    if (b.count == b.slots) {
+        b.slots = b.slots ? 2 * b.slots : 1024;
+        b.starts = (size_t*) realloc(b.starts, b.slots * sizeof(size_t));
+        b.lengths = (int*) realloc(b.lengths, b.slots * sizeof(int));
+    }
+
+    // "appendLine" always leaves room for the terminator
+    b.data[b.used++] = 0;
+
+    b.starts[b.count] = recordStart;
+    b.lengths[b.count] = (int) n;
+    b.count++;
+
+    accepted++;
+
+}
+
+bool SequenceReader::next(Batch& b) {
+
+    // A batch always ends right after a record, so a record in progress has nothing in the batch yet
+
+    b.used = 0;
+    b.count = 0;
+    recordStart = 0;
+
+    if (!file) return false;
+
+    const char* line;
+    size_t n;
+    bool full = false;
+
+    while (!full && nextLine(line, n)) {
+
+        // Blank lines carry no information between records, but within a FASTQ record every line counts towards its...
+        // ...four: a read of length zero has an empty sequence line and an empty quality line
+        if (n == 0 && (!detected || !fastq || phase == 0)) continue;
+
+        if (!detected) {
+            fastq = line[0] == '@';
+            detected = true;
+        }
+
+        if (fastq) {
+
+            // Header, sequence, separator, qualities: only the sequence line is kept
+
+            if (phase == 0) startRecord(b);
+            else if (phase == 1) { appendLine(b, line, n); finishRecord(b); full = b.used >= batchBytes; }
+
+            phase = (phase + 1) % 4;
+
+        } else if (line[0] == '>') {
+
+            // A FASTA record only ends where the next one starts (or at the end of the file)
+
+            if (inRecord) { finishRecord(b); full = b.used >= batchBytes; }
+            startRecord(b);
+            inRecord = true;
+
+        } else if (inRecord) {
+            appendLine(b, line, n);
+        }
+
+    }
+
+    if (!full && inRecord) {
+        finishRecord(b);
+        inRecord = false;
+    }
+
+    return b.count > 0;
+
+}
+
+long long SequenceReader::load(RadixTree& tree) {
+
+    // Two batches take turns: the parser fills one while the caller inserts the other
+    // "full[i]" is set by the parser once batch "i" is ready, and cleared by the caller once it is inserted
+
+    Batch batches[2];
+    bool full[2] = {false, false};
+    bool done = false;
+
+    mutex lock;
+    condition_variable changed;
+
+    thread parser([&]() {
+
+        for (int i = 0;; i ^= 1) {
+
+            {
+                unique_lock<mutex> guard(lock);
+                changed.wait(guard, [&]() { return !full[i]; });
+            }
+
+            bool more = next(batches[i]);
+
+            {
+                lock_guard<mutex> guard(lock);
+                if (more) full[i] = true;
+                else done = true;
+            }
+
+            changed.notify_all();
+            if (!more) break;
+
+        }
+
+    });
+
+    long long added = 0;
+
+    for (int i = 0;; i ^= 1) {
+
+        {
+            unique_lock<mutex> guard(lock);
+            changed.wait(guard, [&]() { return full[i] || done; });
+            if (!full[i]) break;
+        }
+
+        Batch& b = batches[i];
+        for (int j = 0; j < b.count; j++) tree.addString(b.string(j), b.length(j));
+        added += b.count;
+
+        {
+            lock_guard<mutex> guard(lock);
+            full[i] = false;
+        }
+
+        changed.notify_all();
+
+    }
+
+    parser.join();
+    return added;
+
+}
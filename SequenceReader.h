@@ -0,0 +1,144 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_SEQUENCEREADER_H
+#define RADIXTREEPROJECT_SEQUENCEREADER_H
+#include <cstdio>
+#include <cstdlib>
+#include <cstddef>
+using namespace std;
+
+class RadixTree;
+
+// Streaming reader for FASTA and FASTQ files, feeding DNA segments to a Radix Tree
+//
+// The file is read in large chunks and scanned line by line in place, with no per-record or per-line allocation.
+// Sequences are validated and uppercased 16 characters at a time (SSE2, with a plain loop as fallback) while being...
+// ...copied into a "Batch": one buffer holding many null-terminated segments back to back. Records containing...
+// ...anything other than A, C, G, T (in either case) are skipped and counted as rejected.
+//
+// The format is detected from the first character of the file ('>' for FASTA, '@' for FASTQ). FASTA sequences may...
+// ...span several lines; FASTQ records are expected in the usual four-line form (header, sequence, '+', qualities),...
+// ...where even an empty sequence takes its two lines. Blank lines are skipped anywhere in FASTA, and only between...
+// ...records in FASTQ.
+//
+class SequenceReader {
+public:
+
+    // A group of segments stored back to back, each one followed by a null terminator
+    // Segment "i" starts at "data + starts[i]" and is "lengths[i]" characters long (terminator not included)
+    class Batch {
+    public:
+
+        char* data;
+        size_t used;
+        size_t capacity;
+
+        size_t* starts;
+        int* lengths;
+        int count;
+        int slots;
+
+        Batch() : data(0), used(0), capacity(0), starts(0), lengths(0), count(0), slots(0) {}
+        ~Batch() { free(data); free(starts); free(lengths); }
+
+        const char* string(int i) const { return data + starts[i]; }
+        int length(int i) const { return lengths[i]; }
+
+    };
+
+private:
+
+    FILE* file;
+
+    // Read buffer, bytes ["begin", "end") are read but not yet scanned
+    char* buffer;
+    size_t bufferSize;
+    size_t begin;
+    size_t end;
+    bool eof;
+
+    // Format and parsing state, kept between calls to "next" since a batch may end in the middle of the buffer
+    // "phase" is the line number within a FASTQ record (0 = header), "inRecord" tells whether FASTA sequence lines...
+    // ...currently belong to a record
+    bool fastq;
+    bool detected;
+    int phase;
+    bool inRecord;
+
+    // Where the current record starts in the batch being filled, and whether all its lines were valid so far
+    size_t recordStart;
+    bool recordValid;
+
+    // Batches are handed over once they hold at least this many bytes
+    size_t batchBytes;
+
+    // Statistics
+    long long accepted;
+    long long rejectedCount;
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Buffer refilling function, responsible for keeping the unscanned bytes and reading as many new ones as fit
+    // The buffer is doubled when a single line does not fit in it
+    //
+    void fill();
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Line reading function, responsible for finding the next complete line in the buffer (refilling it if needed)
+    //
+    bool nextLine(const char*& line, size_t& n);
+    // Returns false once the whole file has been scanned, the line excludes its "\n" (and "\r", if any)
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Record building functions, responsible for starting a record, appending a sequence line to it, and either...
+    // ...keeping it in the batch (if valid and not empty) or rolling it back
+    //
+    void startRecord(Batch& b);
+    void appendLine(Batch& b, const char* line, size_t n);
+    void finishRecord(Batch& b);
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Validation function, responsible for copying "n" characters from "src" to "dst" while uppercasing them
+    //
+    static bool copyACGT(const char* src, char* dst, size_t n);
+    // Returns false if any character is not one of A, C, G, T (in either case)
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Readers cannot be copied, they own the file
+    SequenceReader(const SequenceReader&);
+    SequenceReader& operator=(const SequenceReader&);
+
+public:
+
+    // Basic constructor, opens the file at "path" (check with "isOpen"); "chunkBytes" is the size of every read and...
+    // ..."batchBytes" the amount of sequence data gathered before a batch is handed over
+    explicit SequenceReader(const char* path, size_t chunkBytes = 1 << 22, size_t batchBytes = 1 << 20);
+
+    // Destructor, closes the file
+    ~SequenceReader();
+
+    bool isOpen() const { return file != 0; }
+
+    // Batch reading function, empties "b" then fills it with the next segments of the file
+    // Returns false (with "b" empty) once there is nothing left
+    bool next(Batch& b);
+
+    // Loading function, adds every segment of the file to "tree"
+    // Parsing runs on a separate thread, one batch ahead of the calling thread, which does all the insertions
+    // Returns the number of segments handed to the tree (duplicates included)
+    long long load(RadixTree& tree);
+
+    // Number of records read so far, and of records skipped because of invalid characters (or no sequence at all)
+    long long records() const { return accepted; }
+    long long rejected() const { return rejectedCount; }
+
+};
+
+#endif //RADIXTREEPROJECT_SEQUENCEREADER_H
@@ -0,0 +1,197 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+using namespace std;
+
+#include "ShardedRadixTree.h"
+#include "Alphabet.h"
+
+ShardedRadixTree::ShardedRadixTree(int bases, bool useArena) {
+
+    // 4^6 = 4096 shards is already far more than there are threads to keep them busy, and every shard's epoch...
+    // ...manager alone takes 8 KB
+    k = bases < 0 ? 0 : bases > 6 ? 6 : bases;
+    count = 1 << (2 * k);
+
+    block = malloc((count + 1) * sizeof(Shard) + CACHE_LINE - 1);
+    shards = (Shard*) (((uintptr_t) block + CACHE_LINE - 1) & ~(uintptr_t) (CACHE_LINE - 1));
+
+    for (int i = 0; i <= count; i++) {
+        new (&shards[i]) Shard();
+        shards[i].tree = new RadixTree(useArena);
+        shards[i].tree->enableConcurrentReads();
+    }
+
+}
+
+ShardedRadixTree::~ShardedRadixTree() {
+
+    for (int i = 0; i <= count; i++) {
+        delete shards[i].tree;
+        shards[i].~Shard();
+    }
+
+    free(block);
+
+}
+
+int ShardedRadixTree::route(const char* str, int n) const {
+
+    if (n < k) return count;
+
+    int b = 0;
+
+    for (int j = 0; j < k; j++) {
+        int c = DNA4::encode((unsigned char) str[j]);
+        if (c < 0) return count;
+        b = 4 * b + c;
+    }
+
+    return b;
+
+}
+
+// Addition and deletion functions, only the segment's own shard is locked
+void ShardedRadixTree::addString(const char* str) {
+
+    int n = (int) strlen(str);
+    Shard& s = shards[route(str, n)];
+
+    lock_guard<mutex> guard(s.lock);
+    s.tree->addString(str, n);
+
+}
+
+void ShardedRadixTree::deleteString(const char* str) {
+
+    int n = (int) strlen(str);
+    Shard& s = shards[route(str, n)];
+
+    lock_guard<mutex> guard(s.lock);
+    s.tree->deleteString(str, n);
+
+}
+
+// Searching function, no lock needed since the shard is in concurrent-read mode
+bool ShardedRadixTree::searchString(const char* str) {
+
+    int n = (int) strlen(str);
+    return shards[route(str, n)].tree->searchString(str, n);
+
+}
+
+// Counting functions, each shard is counted under its lock (its counts are only ever updated under it)
+int ShardedRadixTree::countStrings() {
+
+    int total = 0;
+
+    for (int i = 0; i <= count; i++) {
+        lock_guard<mutex> guard(shards[i].lock);
+        total += shards[i].tree->countStrings();
+    }
+
+    return total;
+
+}
+
+int ShardedRadixTree::countNodes() {
+
+    int total = 0;
+
+    for (int i = 0; i <= count; i++) {
+        lock_guard<mutex> guard(shards[i].lock);
+        total += shards[i].tree->countNodes();
+    }
+
+    return total;
+
+}
+
+// Iteration start function, starts at the first regular shard with segments and at the start of the overflow shard
+ShardedRadixTree::iterator ShardedRadixTree::begin() const {
+
+    iterator it;
+    it.tree = this;
+    it.shard = 0;
+    it.current = shards[0].tree->begin();
+    it.overflow = shards[count].tree->begin();
+
+    it.skipEmpty();
+    it.pick();
+
+    return it;
+
+}
+
+void ShardedRadixTree::iterator::skipEmpty() {
+    while (current == RadixTree::iterator() && shard + 1 < tree->count) current = tree->shards[++shard].tree->begin();
+}
+
+void ShardedRadixTree::iterator::pick() {
+
+    bool currentDone = current == RadixTree::iterator(), overflowDone = overflow == RadixTree::iterator();
+
+    // Both at the end: this becomes the end iterator
+    if (currentDone && overflowDone) {
+        tree = 0;
+        shard = 0;
+        fromOverflow = false;
+        return;
+    }
+
+    // Segments are compared as unsigned characters, which is the order every shard keeps its siblings in
+    fromOverflow = currentDone || (!overflowDone && strcmp(*overflow, *current) < 0);
+
+}
+
+// Iterator increment function, moves on whichever of the two iterators the current segment came from
+ShardedRadixTree::iterator& ShardedRadixTree::iterator::operator++() {
+
+    if (!tree) return *this;
+
+    if (fromOverflow) ++overflow;
+    else {
+        ++current;
+        skipEmpty();
+    }
+
+    pick();
+
+    return *this;
+
+}
+
+// Iterator comparison, two iterators are equal if both are at the end or both are at the same segment
+bool ShardedRadixTree::iterator::operator==(const iterator& rhs) const {
+
+    if (!tree || !rhs.tree) return tree == rhs.tree;
+    if (fromOverflow != rhs.fromOverflow) return false;
+
+    return fromOverflow ? overflow == rhs.overflow : shard == rhs.shard && current == rhs.current;
+
+}
+
+// Printing function, same output as "RadixTree::sortAndPrintStrings", the iterator doing the merging
+void ShardedRadixTree::sortAndPrintStrings(const char* address, bool echo) {
+
+    ExportBuffer out(address, echo);
+    if (!out.active()) return;
+
+    out.write("String Count: ");
+    out.writeNumber(countStrings());
+    out.write("\nNote: Duplicate strings are prohibited in the Radix Tree.\n\n");
+
+    for (iterator it = begin(); it != end(); ++it) {
+        out.write(*it, it.length() + 1);
+        out.put('\n');
+    }
+
+}
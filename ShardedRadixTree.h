@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_SHARDEDRADIXTREE_H
+#define RADIXTREEPROJECT_SHARDEDRADIXTREE_H
+#include <mutex>
+using namespace std;
+
+#include "RadixTree.h"
+
+// A set of DNA segments split over 4^k independent Radix Trees ("shards"), so that many threads can add and delete...
+// ...segments at the same time
+//
+// A segment goes to the shard numbered by its first "k" bases read as a base-4 number (A = 0, C = 1, G = 2, T = 3),...
+// ...which puts the shards in alphabetical order: every segment of shard "b" comes before every segment of shard...
+// ..."b + 1". Segments shorter than "k" bases or holding anything but A, C, G, T in their first "k" characters all go...
+// ...to one more shard of their own, the "overflow" shard, merged back in order by iteration.
+//
+// Every shard has its own lock, taken by "addString" / "deleteString", so writers only wait for each other when...
+// ...they hit the same shard. Shards run in concurrent-read mode (see "RadixTree::enableConcurrentReads"), which...
+// ..."searchString" relies on to search without taking any lock at all, while its shard's writer is active.
+//
+// The whole-set functions see every shard as it is when they get to it. Counting takes each shard's lock in turn;...
+// ...iteration and printing take none and, as for "RadixTree", must NOT run while writers are active.
+//
+class ShardedRadixTree {
+private:
+
+    static const int CACHE_LINE = 64;
+
+    // A shard and its lock, aligned (hence padded) to cache lines of its own so that writers of neighbouring shards...
+    // ...do not keep invalidating each other's lock
+    struct alignas(CACHE_LINE) Shard {
+        mutex lock;
+        RadixTree* tree;
+    };
+
+    // Number of bases used for routing, number of regular shards ("4^k"), and all shards (the overflow one last)
+    // "new[]" need not honour "alignas" before C++17, so the shards are built in place in "block", a "malloc"-ed...
+    // ...block one cache line larger than needed, from its first cache line boundary on
+    int k;
+    int count;
+    void* block;
+    Shard* shards;
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Routing function, responsible for finding the shard of the "n" characters of "str"
+    //
+    int route(const char* str, int n) const;
+    // Returns the number of the shard, "count" meaning the overflow shard
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Sharded trees cannot be copied, they own their shards and locks
+    ShardedRadixTree(const ShardedRadixTree&);
+    ShardedRadixTree& operator=(const ShardedRadixTree&);
+
+public:
+
+    // Forward iterator over the segments of all shards in alphabetical order
+    //
+    // The regular shards are gone through one after the other, and merged on the way with the overflow shard, whose...
+    // ...segments fall in between. The string an iterator points at is only valid until it moves on.
+    //
+    class iterator {
+    private:
+
+        friend class ShardedRadixTree;
+
+        const ShardedRadixTree* tree;
+
+        // Regular shard being gone through and where it is at, and where the overflow shard is at
+        int shard;
+        RadixTree::iterator current;
+        RadixTree::iterator overflow;
+
+        // Whether the current segment comes from the overflow shard
+        bool fromOverflow;
+
+        // Moves on to the next regular shard with segments, if "current" is at the end of its shard
+        void skipEmpty();
+
+        // Picks whichever of "current" and "overflow" comes first
+        void pick();
+
+    public:
+
+        // Basic constructor, creates the end iterator
+        iterator() : tree(0), shard(0), fromOverflow(false) {}
+
+        // The current segment, and its length (null terminator NOT included)
+        const char* operator*() const { return fromOverflow ? *overflow : *current; }
+        int length() const { return fromOverflow ? overflow.length() : current.length(); }
+
+        // Moves on to the next segment in alphabetical order (or to the end)
+        iterator& operator++();
+
+        bool operator==(const iterator& rhs) const;
+        bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+
+    };
+
+    // Basic constructor, creates "4^k" empty shards ("k" between 0 and 6) plus the overflow shard, each backed by an...
+    // ...arena of its own if "useArena" is true
+    explicit ShardedRadixTree(int k = 3, bool useArena = false);
+
+    // Destructor, destroys every shard (no other thread may still be using the tree)
+    ~ShardedRadixTree();
+
+    // Publicly usable functions, names self-explanatory, safe to call from any number of threads at once
+    void addString(const char* str);
+    void deleteString(const char* str);
+    bool searchString(const char* str);
+    int countStrings();
+    int countNodes();
+
+    // Number of shards (the overflow one included), and shard "i" itself, e.g. to look at how evenly they are filled
+    int shardCount() const { return count + 1; }
+    const RadixTree* shardAt(int i) const { return shards[i].tree; }
+
+    iterator begin() const;
+    iterator end() const { return iterator(); }
+
+    // Printing function, prints the segments of all shards in alphabetical order, in the same format as...
+    // ..."RadixTree::sortAndPrintStrings"
+    void sortAndPrintStrings(const char* address, bool echo = false);
+
+};
+
+#endif //RADIXTREEPROJECT_SHARDEDRADIXTREE_H
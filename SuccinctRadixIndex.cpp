@@ -0,0 +1,370 @@
+//----------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//----------------------------------------------------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+using namespace std;
+
+#include "SuccinctRadixIndex.h"
+
+// File header: magic and format version
+static const char MAGIC[8] = {'R', 'D', 'X', 'L', 'O', 'U', 'D', 'S'};
+static const uint32_t VERSION = 1;
+
+SuccinctRadixIndex::SuccinctRadixIndex() : symbols(0), symbolCount(0), symbolCapacity(0), nodes(0), strings(0) {}
+
+SuccinctRadixIndex::~SuccinctRadixIndex() {
+    free(symbols);
+}
+
+bool SuccinctRadixIndex::append(const char* label, int n, int children, bool end) {
+
+    // Codes are checked before anything is appended, so that a rejected node leaves the index as it was
+
+    for (int i = 0; i < n; i++) if (DNA4::encode((unsigned char) label[i]) < 0) return false;
+
+    for (int i = 0; i < children; i++) louds.push(true);
+    louds.push(false);
+
+    terminal.push(end);
+
+    for (int i = 0; i < n; i++) {
+
+        if (symbolCount == symbolCapacity * 32) {
+            symbolCapacity = symbolCapacity ? 2 * symbolCapacity : 16;
+            symbols = (uint64_t*) realloc(symbols, symbolCapacity * sizeof(uint64_t));
+        }
+
+        if (symbolCount % 32 == 0) symbols[symbolCount / 32] = 0;
+        symbols[symbolCount / 32] |= (uint64_t) DNA4::encode((unsigned char) label[i]) << (2 * (symbolCount % 32));
+        symbolCount++;
+
+        starts.push(i == 0);
+
+    }
+
+    // The virtual root is the first node appended and is not counted
+    if (terminal.size() > 1) nodes++;
+    if (end) strings++;
+
+    return true;
+
+}
+
+void SuccinctRadixIndex::build() {
+
+    // The extra set bit marks the end of the last label
+    starts.push(true);
+
+    louds.build();
+    terminal.build();
+    starts.build();
+
+    symbolCapacity = (symbolCount + 31) / 32;
+    if (symbolCapacity) symbols = (uint64_t*) realloc(symbols, symbolCapacity * sizeof(uint64_t));
+
+}
+
+bool SuccinctRadixIndex::valid() const {
+
+    // Every node but the virtual root is somebody's child (one set bit each) and every node ends with a zero, the...
+    // ...last bit being the zero ending the last node
+
+    if (louds.rank1(louds.size()) != nodes || !louds.size() || louds.get(louds.size() - 1)) return false;
+
+    // Node "z" starts after the "z"-th zero and its first child is one past the ones before that, which must be at...
+    // ...least "z" for its children to come after it
+
+    uint64_t ones = 0, zeros = 0;
+
+    for (uint64_t p = 0; p < louds.size(); p++) {
+        if (louds.get(p)) ones++;
+        else if (++zeros <= nodes && ones < zeros) return false;
+    }
+
+    // One terminal flag per string, and one label start per node plus the end of the last label, right at the end
+
+    return terminal.rank1(terminal.size()) == strings &&
+           starts.rank1(starts.size()) == nodes + 1 && starts.get(symbolCount);
+
+}
+
+uint64_t SuccinctRadixIndex::child(uint64_t i, int c, uint64_t& start, uint64_t& end) const {
+
+    // The bits of node "i" in "louds" start right after the "i"-th zero, one set bit per child
+
+    uint64_t p = i ? louds.select0(i - 1) + 1 : 0;
+    if (!louds.get(p)) return 0;
+
+    uint64_t first = p - i + 1;
+    uint64_t s = starts.select1(first - 1);
+
+    // Children are sorted by their first base and there are at most 4 of them, so they are simply gone through...
+    // ...in order, the end of one label being the start of the next
+
+    for (uint64_t j = first; ; j++) {
+
+        uint64_t e = starts.nextOne(s + 1);
+        int base = symbolAt(s);
+
+        if (base == c) {
+            start = s;
+            end = e;
+            return j;
+        }
+
+        if (base > c || !louds.get(p + (j - first) + 1)) return 0;
+
+        s = e;
+
+    }
+
+}
+
+uint64_t SuccinctRadixIndex::findPrefix(const char* p, int m, int& offset) const {
+
+    uint64_t t = 0, s, e;
+    offset = 0;
+
+    while (m > 0) {
+
+        int c = DNA4::encode((unsigned char) *p);
+        if (c < 0) return 0;
+
+        uint64_t j = child(t, c, s, e);
+        if (!j) return 0;
+
+        // Compare the rest of the label (its first base is already known to match) with the rest of "p"
+
+        int len = (int) (e - s), k = 1;
+        while (k < len && k < m && symbolAt(s + k) == DNA4::encode((unsigned char) p[k])) k++;
+
+        // All of "p" matched, within this label or right at its end: every string beneath it starts with "p"
+        if (k == m) return j;
+
+        // The label goes a different way than "p" before "p" ends
+        if (k != len) return 0;
+
+        p += k;
+        m -= k;
+        offset += k;
+        t = j;
+
+    }
+
+    return t;
+
+}
+
+// Searching function, measures the string once then looks it up
+bool SuccinctRadixIndex::searchString(const char* str) {
+    return searchString(str, (int) strlen(str));
+}
+
+// Explicit-length searching function, walks down label by label then checks the terminal flag of the last node
+bool SuccinctRadixIndex::searchString(const char* str, int len) {
+
+    uint64_t t = 0, s, e;
+
+    while (len > 0) {
+
+        int c = DNA4::encode((unsigned char) *str);
+        if (c < 0) return false;
+
+        uint64_t j = child(t, c, s, e);
+        if (!j) return false;
+
+        // The whole label must match for the walk to go on (its first base already does)
+
+        int l = (int) (e - s);
+        if (len < l) return false;
+
+        for (int k = 1; k < l; k++) if (symbolAt(s + k) != DNA4::encode((unsigned char) str[k])) return false;
+
+        str += l;
+        len -= l;
+        t = j;
+
+    }
+
+    return terminal.get(t);
+
+}
+
+// Prefix counting function, counts the terminal nodes of the sub-tree one level at a time
+long long SuccinctRadixIndex::countWithPrefix(const char* prefix) {
+
+    int m = (int) strlen(prefix), offset;
+
+    uint64_t t = findPrefix(prefix, m, offset);
+    if (!t && m) return 0;
+
+    // The descendants of node "t" on any given level are the contiguous range [l, r) of that level, and the...
+    // ...children of that range are the range that follows on the next level
+
+    uint64_t l = t, r = t + 1, total = 0;
+
+    while (l < r) {
+        total += terminal.rank1(r) - terminal.rank1(l);
+        l = firstChild(l);
+        r = firstChild(r);
+    }
+
+    return (long long) total;
+
+}
+
+// Prefix scanning function, goes through the sub-tree of the node where the prefix ends depth-first, children in order
+long long SuccinctRadixIndex::forEachWithPrefix(const char* prefix, Visitor visit, void* context) {
+
+    int m = (int) strlen(prefix), offset;
+    long long visited = 0;
+
+    uint64_t t = findPrefix(prefix, m, offset);
+    if (!t && m) return 0;
+
+    // Every level of the stack is a range of siblings still to be visited, and where their labels go in "buffer"
+
+    int depth = 0, capacity = 16, bufferSize = offset + 128;
+    uint64_t* next = (uint64_t*) malloc(capacity * sizeof(uint64_t));
+    uint64_t* ends = (uint64_t*) malloc(capacity * sizeof(uint64_t));
+    int* offsets = (int*) malloc(capacity * sizeof(int));
+    char* buffer = (char*) malloc(bufferSize);
+
+    memcpy(buffer, prefix, offset);
+
+    next[0] = t;
+    ends[0] = t + 1;
+    offsets[0] = offset;
+    depth = 1;
+
+    while (depth) {
+
+        if (next[depth - 1] == ends[depth - 1]) {
+            depth--;
+            continue;
+        }
+
+        uint64_t j = next[depth - 1]++;
+        int at = offsets[depth - 1], len = 0;
+
+        // Decode the label of node "j" (the virtual root has none) after the labels above it
+
+        if (j) {
+
+            uint64_t s = starts.select1(j - 1), e = starts.nextOne(s + 1);
+            len = (int) (e - s);
+
+            if (at + len + 1 > bufferSize) {
+                bufferSize = 2 * (at + len + 1);
+                buffer = (char*) realloc(buffer, bufferSize);
+            }
+
+            for (int k = 0; k < len; k++) buffer[at + k] = DNA4::decode(symbolAt(s + k));
+
+        }
+
+        // A string ending here comes before all the strings below, which only extend it
+
+        if (terminal.get(j)) {
+            buffer[at + len] = 0;
+            visited++;
+            if (visit && !visit(buffer, at + len, context)) break;
+        }
+
+        uint64_t first = firstChild(j), last = firstChild(j + 1);
+        if (first == last) continue;
+
+        if (depth == capacity) {
+            capacity *= 2;
+            next = (uint64_t*) realloc(next, capacity * sizeof(uint64_t));
+            ends = (uint64_t*) realloc(ends, capacity * sizeof(uint64_t));
+            offsets = (int*) realloc(offsets, capacity * sizeof(int));
+        }
+
+        next[depth] = first;
+        ends[depth] = last;
+        offsets[depth] = at + len;
+        depth++;
+
+    }
+
+    free(next);
+    free(ends);
+    free(offsets);
+    free(buffer);
+
+    return visited;
+
+}
+
+long long SuccinctRadixIndex::bytes() const {
+    return (long long) sizeof(*this) + louds.bytes() + terminal.bytes() + starts.bytes() +
+           (long long) (symbolCapacity * sizeof(uint64_t));
+}
+
+bool SuccinctRadixIndex::save(const char* path) const {
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+
+    uint64_t words = (symbolCount + 31) / 32;
+
+    bool ok = fwrite(MAGIC, 1, sizeof(MAGIC), file) == sizeof(MAGIC) &&
+              fwrite(&VERSION, sizeof(VERSION), 1, file) == 1 &&
+              fwrite(&nodes, sizeof(nodes), 1, file) == 1 &&
+              fwrite(&strings, sizeof(strings), 1, file) == 1 &&
+              louds.write(file) && terminal.write(file) && starts.write(file) &&
+              fwrite(&symbolCount, sizeof(symbolCount), 1, file) == 1 &&
+              fwrite(symbols, sizeof(uint64_t), words, file) == words;
+
+    return fclose(file) == 0 && ok;
+
+}
+
+SuccinctRadixIndex* SuccinctRadixIndex::load(const char* path) {
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return 0;
+
+    SuccinctRadixIndex* index = new SuccinctRadixIndex();
+
+    char magic[8];
+    uint32_t version;
+
+    bool ok = fread(magic, 1, sizeof(magic), file) == sizeof(magic) && memcmp(magic, MAGIC, sizeof(MAGIC)) == 0 &&
+              fread(&version, sizeof(version), 1, file) == 1 && version == VERSION &&
+              fread(&index->nodes, sizeof(index->nodes), 1, file) == 1 &&
+              fread(&index->strings, sizeof(index->strings), 1, file) == 1 &&
+              index->louds.read(file) && index->terminal.read(file) && index->starts.read(file) &&
+              fread(&index->symbolCount, sizeof(index->symbolCount), 1, file) == 1;
+
+    // The sizes must all agree with each other before the labels are read, and the labels are the end of the file
+
+    ok = ok && index->louds.size() == 2 * index->nodes + 1 && index->terminal.size() == index->nodes + 1 &&
+         index->starts.size() == index->symbolCount + 1;
+
+    if (ok) {
+        uint64_t words = (index->symbolCount + 31) / 32;
+        index->symbolCapacity = words;
+        index->symbols = (uint64_t*) malloc((words ? words : 1) * sizeof(uint64_t));
+        ok = index->symbols && fread(index->symbols, sizeof(uint64_t), words, file) == words;
+    }
+
+    ok = ok && index->valid();
+
+    fclose(file);
+
+    if (!ok) {
+        delete index;
+        return 0;
+    }
+
+    return index;
+
+}
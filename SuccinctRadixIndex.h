@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------------------------------------------------------------------------
+// This project was created for CSE_331 Data Structures And Algorithms course offered in
+// Ain Shams University - Faculty of Engineering under the guidance and influence of Dr. Ashraf Abdel Raouf
+//
+// This implementation has been greatly influenced by the implementation found in the following source:
+// https://kukuruku.co/post/radix-trees/
+//---------------------------------------------------------------------------------------------------------------------------------------------
+#ifndef RADIXTREEPROJECT_SUCCINCTRADIXINDEX_H
+#define RADIXTREEPROJECT_SUCCINCTRADIXINDEX_H
+#include <cstdint>
+using namespace std;
+
+#include "BitVector.h"
+#include "Alphabet.h"
+
+// A read-only Radix Tree of DNA segments taking a few bits per node, as built by "RadixTree::exportSuccinct"
+//
+// The shape of the tree is stored as LOUDS (level-order unary degree sequence): going through the nodes in...
+// ...breadth-first order, every node appends one 1 per child followed by a 0, so "n" nodes take "2n + 1" bits and...
+// ...navigating is done with rank / select on that bit vector alone (see "BitVector"). Node "i" (0 being the...
+// ...virtual root, the others numbered in breadth-first order) has its children numbered from "firstChild(i)" to...
+// ..."firstChild(i + 1) - 1", and since breadth-first order keeps every level of a sub-tree contiguous, counting the...
+// ...strings under a node takes one range per level rather than a walk over the whole sub-tree.
+//
+// The rest is stored the same way "AlphabetRadixTree" stores it, with no pointer anywhere:
+//
+// -- terminal: one bit per node, set if a string ends after the node's label (the null terminator is not stored,...
+//              ...so the "\0" leaves of "RadixTree" disappear and a leaf "GA\0" becomes a terminal node "GA")
+// -- starts:   one bit per label symbol, set on the first symbol of every label, with one more set bit at the end...
+//              ...so that every label ends where the next one starts
+// -- symbols:  the labels of all nodes back to back in breadth-first order, packed at 2 bits per base ("DNA4" codes)
+//
+// All in all about 3 bits per node plus 3 bits per label base, against 40 bytes per node for "RadixTree". Only...
+// ...strings made of A, C, G, T can be stored, which is what the 2-bit packing relies on.
+//
+class SuccinctRadixIndex {
+public:
+
+    // Callback used by the scanning function, same as "RadixTree::Visitor"
+    typedef bool (*Visitor)(const char* str, int len, void* context);
+
+private:
+
+    // Only "RadixTree" builds indexes, through "append" and "build"
+    friend class RadixTree;
+
+    BitVector louds;
+    BitVector terminal;
+    BitVector starts;
+
+    // Packed labels, base "i" being bits "2 * (i % 32)" and up of word "i / 32"
+    uint64_t* symbols;
+    uint64_t symbolCount;
+    uint64_t symbolCapacity;
+
+    // Number of nodes (the virtual root excluded) and of strings
+    uint64_t nodes;
+    uint64_t strings;
+
+    // Basic constructor, creates an index without any node, not even the virtual root
+    SuccinctRadixIndex();
+
+    // Indexes cannot be copied, they own their bit vectors
+    SuccinctRadixIndex(const SuccinctRadixIndex&);
+    SuccinctRadixIndex& operator=(const SuccinctRadixIndex&);
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Appending function, responsible for adding the next node in breadth-first order (the virtual root first), with...
+    // ...its "n" label characters "label" (no null terminator), its number of children and its terminal flag
+    //
+    bool append(const char* label, int n, int children, bool end);
+    // Returns false if the label holds anything but A, C, G, T
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // Finishing function, closes the label pool and builds the rank / select directories once every node is appended
+    void build();
+
+    // Checks, once an index is read back, that the bit vectors hold as many ones and zeros as "nodes" and "strings"...
+    // ...call for, that every node's children come after it (so that every walk goes down and ends) and that the...
+    // ...labels all stay within the label pool, so that a corrupted file is rejected rather than navigated outside of...
+    // ...its arrays. This goes through the LOUDS bits once
+    bool valid() const;
+
+    // Number of the first child of node "i" (the children of node "i" being numbered up to "firstChild(i + 1) - 1")
+    uint64_t firstChild(uint64_t i) const { return (i ? louds.select0(i - 1) + 1 : 0) - i + 1; }
+
+    // Code of the base at position "p" of the label pool
+    int symbolAt(uint64_t p) const { return (int) ((symbols[p / 32] >> (2 * (p % 32))) & 3); }
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Child finding function, responsible for finding the child of node "i" whose label starts with base code "c"
+    // "start" and "end" receive where the label of that child starts and ends in the label pool
+    //
+    uint64_t child(uint64_t i, int c, uint64_t& start, uint64_t& end) const;
+    // Returns the number of that child, or 0 (the virtual root, which is nobody's child) if there is none
+    // ---------------------------------------------------------------------------------------------------------------
+
+    // ---------------------------------------------------------------------------------------------------------------
+    // Prefix finder function, same as "RadixTree::findPrefix"
+    //
+    uint64_t findPrefix(const char* p, int m, int& offset) const;
+    // Returns the number of the node under which all the strings starting with "p" are stored (the virtual root if...
+    // ..."m" is 0), or 0 if there is none while "m" is not 0
+    // ---------------------------------------------------------------------------------------------------------------
+
+public:
+
+    // Destructor, de-allocates the packed labels (the bit vectors take care of themselves)
+    ~SuccinctRadixIndex();
+
+    // File functions:
+    // -- save:  writes the index to the file at "path", returns false if the file cannot be written
+    // -- load:  reads an index written by "save", returns NULL if the file is missing or invalid. The caller deletes it
+    //
+    bool save(const char* path) const;
+    static SuccinctRadixIndex* load(const char* path);
+
+    // Publicly usable functions, names self-explanatory, they work exactly like their "RadixTree" counterparts
+    // Counts are 64-bit, these indexes being meant for more strings than a "RadixTree" would hold in memory
+    // "countNodes" does not count the "\0" leaves of "RadixTree", which the index does without (see above)
+    bool searchString(const char* str);
+    bool searchString(const char* str, int len);
+    long long countStrings() const { return (long long) strings; }
+    long long countNodes() const { return (long long) nodes; }
+
+    // Prefix scan functions, same as "RadixTree::countWithPrefix" and "RadixTree::forEachWithPrefix"
+    // Counting takes two selects and two ranks per level below the node where "prefix" ends
+    // Scanning with an empty prefix enumerates every string in alphabetical order
+    long long countWithPrefix(const char* prefix);
+    long long forEachWithPrefix(const char* prefix, Visitor visit, void* context = 0);
+
+    // Number of bytes taken by the index: bit vectors, their directories and the packed labels
+    long long bytes() const;
+
+};
+
+#endif //RADIXTREEPROJECT_SUCCINCTRADIXINDEX_H
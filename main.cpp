@@ -111,7 +111,7 @@ void runRadixTreeDNATest(char address[], int addressSize, bool echo, int min, in
 
     static unsigned int testNum = 0; // Initialization of variable to store test number
     char* n = intToChars(++testNum); // Increment and convert on every call
-    RadixTree* rt = new RadixTree(); // Instantiate a Radix Tree
+    RadixTree* rt = new RadixTree(true); // Instantiate an arena-backed Radix Tree (cheap to tear down at the end)
 
     cout << "Generating and inserting DNA Segments for Test #" << testNum << "...\n" << (echo ? "\n" : "");
 
@@ -216,6 +216,6 @@ void runRadixTreeDNATest(char address[], int addressSize, bool echo, int min, in
     cout << (echo ? "\n" : "") << "Cleaning up, please wait...\n";
     cout << "If this is the last test, you may force exit.\n\n" << (echo ? "\n\n" : "");
 
-    delete rt; // FIXME: Very slow, can't put my hands on why yet
+    delete rt; // Releases the tree's slabs as a whole instead of freeing every node and key one by one
 
 }
\ No newline at end of file